@@ -16,20 +16,149 @@
 
 // Needed for communication with BGT60TR13C (over SPI)
 #include "cyhal_spi.h"
+#include "cyhal_gpio.h"
+#include "cyhal_system.h"
 #include "cycfg_pins.h"
 
 #include "xensiv_bgt60trxx_mtb.h"
 
+#include "hal_timer.h"
+#include "spi_calibration.h"
+
 #include <stdlib.h>
+#include <string.h>
 
-#define XENSIV_BGT60TRXX_CONF_IMPL
+// Default profile (the register lists are in radar_profiles.c)
 #include "radar_settings.h"
+#include "radar_profiles.h"
+
+/**
+ * @def BGT60TRXXX_CHIRPS_PER_READ
+ * @brief Maximum number of chirps read from the FIFO at once (FIFO interrupt level)
+ * Each profile reads the largest number of chirps dividing its chirps per frame up to this value
+ * Less than the number of chirps per frame -> streaming: the chirps are processed while the frame is measured,
+ * only a chunk has to fit inside the FIFO (and inside a buffer of the pool)
+ */
+#ifndef BGT60TRXXX_CHIRPS_PER_READ
+#define BGT60TRXXX_CHIRPS_PER_READ			XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME
+#endif
+
+#if (BGT60TRXXX_CHIRPS_PER_READ == 0)
+#error "BGT60TRXXX_CHIRPS_PER_READ must not be 0"
+#endif
+
+/**
+ * @def BGT60TRXXX_FRAME_POOL_SIZE
+ * @brief Number of frame buffers: while the consumer owns a frame, the next ones are read into the others
+ * (2 -> ping-pong). Each buffer holds one FIFO read (BGT60TRXXX_CHIRPS_PER_READ chirps)
+ */
+#ifndef BGT60TRXXX_FRAME_POOL_SIZE
+#define BGT60TRXXX_FRAME_POOL_SIZE			2
+#endif
+
+/**
+ * @def BGT60TRXXX_IRQ_PIN
+ * @brief Pin connected to the IRQ pin of the sensor (FIFO interrupt, high while the FIFO level is reached)
+ */
+#define BGT60TRXXX_IRQ_PIN					ARDU_IO6
 
-#define NUM_SAMPLES_PER_FRAME               (XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS *\
-                                             XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME *\
-                                             XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP)
+/**
+ * @def BGT60TRXXX_SPI_FREQUENCY
+ * @brief SPI clock used until the calibration (and if the calibration fails)
+ */
+#define BGT60TRXXX_SPI_FREQUENCY			12500000UL
 
-#define NUM_SAMPLES_PER_CHIRP				XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP
+/**
+ * @def BGT60TRXXX_SPI_HS_READ_FREQUENCY
+ * @brief SPI clocks above this value use the high speed mode of the sensor (MISO_HS_READ: data sent out
+ * with the rising edge of the clock, more timing budget for the MCU)
+ */
+#define BGT60TRXXX_SPI_HS_READ_FREQUENCY	25000000UL
+
+/**
+ * @def BGT60TRXXX_SPI_CALIBRATION_WORDS
+ * @brief Test words checked per SPI clock during the calibration
+ */
+#ifndef BGT60TRXXX_SPI_CALIBRATION_WORDS
+#define BGT60TRXXX_SPI_CALIBRATION_WORDS	4096UL
+#endif
+
+/**
+ * @def BGT60TRXXX_SPI_CALIBRATION_MARGIN
+ * @brief Clock steps kept below the first clock with errors
+ */
+#ifndef BGT60TRXXX_SPI_CALIBRATION_MARGIN
+#define BGT60TRXXX_SPI_CALIBRATION_MARGIN	1
+#endif
+
+/**
+ * Time needed by the sensor to measure the chirps of a FIFO read in ms (frame start included)
+ */
+#define CALIBRATION_READ_WAIT_MS			((uint32_t)(chirps_per_read * profile->chirp_repetition_time * 1000.f) + 2U)
+
+/**
+ * Frame end delay (CCR1): TR_FED * 2^TR_FED_MUL * 8 clock cycles of the 80 MHz sensor clock
+ * (fields of CCR1 not defined by xensiv_bgt60trxx_regs.h)
+ */
+#define CCR1_TR_FED_POS						11U
+#define CCR1_TR_FED_MSK						0x07f800UL
+#define CCR1_TR_FED_MUL_POS					19U
+#define CCR1_TR_FED_MUL_MSK					0xf80000UL
+#define FRAME_END_DELAY_TICK_S				(8.f / 80e6f)
+#define FRAME_END_DELAY_TR_MAX				(CCR1_TR_FED_MSK >> CCR1_TR_FED_POS)
+#define FRAME_END_DELAY_MUL_MAX				(CCR1_TR_FED_MUL_MSK >> CCR1_TR_FED_MUL_POS)
+
+/**
+ * @def BGT60TRXXX_RECOVERY_RESTARTS
+ * @brief Consecutive FIFO errors recovered by restarting the frame generation before a soft reset
+ */
+#ifndef BGT60TRXXX_RECOVERY_RESTARTS
+#define BGT60TRXXX_RECOVERY_RESTARTS		3
+#endif
+
+/**
+ * @def BGT60TRXXX_RECOVERY_SOFT_RESETS
+ * @brief Consecutive FIFO errors recovered by a soft reset (and reconfiguration) before a hard reset
+ */
+#ifndef BGT60TRXXX_RECOVERY_SOFT_RESETS
+#define BGT60TRXXX_RECOVERY_SOFT_RESETS		2
+#endif
+
+/**
+ * @def BGT60TRXXX_RECOVERY_BACKOFF_US
+ * @brief Delay before the recovery of a first FIFO error, doubled at each consecutive error
+ */
+#ifndef BGT60TRXXX_RECOVERY_BACKOFF_US
+#define BGT60TRXXX_RECOVERY_BACKOFF_US		1000UL
+#endif
+
+/**
+ * @def BGT60TRXXX_FIFO_READ_TIMEOUT_US
+ * @brief Longest wait for the end of a FIFO read before it is aborted (lost SPI event, stuck bus)
+ */
+#ifndef BGT60TRXXX_FIFO_READ_TIMEOUT_US
+#define BGT60TRXXX_FIFO_READ_TIMEOUT_US		100000UL
+#endif
+
+#ifndef BGT60TRXXX_RECOVERY_BACKOFF_MAX_US
+#define BGT60TRXXX_RECOVERY_BACKOFF_MAX_US	1000000UL
+#endif
+
+typedef enum
+{
+	FRAME_FREE = 0,		/**< Can receive the next FIFO read */
+	FRAME_READING,		/**< FIFO read in progress */
+	FRAME_READY,		/**< Filled, waiting for the consumer */
+	FRAME_ACQUIRED,		/**< Owned by the consumer */
+} frame_state_t;
+
+typedef struct
+{
+	uint16_t* data;				/**< pool_samples samples (the raw FIFO data are read at the beginning) */
+	volatile frame_state_t state;
+	uint32_t sequence;			/**< Order of the FIFO reads */
+	uint16_t first_chirp;		/**< Index inside the frame of the first chirp of the buffer */
+} frame_slot_t;
 
 
 /**
@@ -42,9 +171,162 @@ static cyhal_spi_t spi_obj;
  */
 static xensiv_bgt60trxx_mtb_t sensor;
 
-static uint16_t data_available = 0;
+/**
+ * Result of the last FIFO read (asynchronous, started by the FIFO interrupt)
+ */
+static volatile int32_t read_status = XENSIV_BGT60TRXX_STATUS_OK;
+
+/**
+ * True while the frame generation is restarted: the FIFO interrupt does not start any read
+ */
+static volatile bool read_suspended = false;
+
+/**
+ * True if the FIFO interrupt could not start a read (read in progress, no free frame buffer):
+ * the read starts at the end of the current read or on release
+ */
+static volatile bool read_pending = false;
+
+/**
+ * Called from the interrupt once a FIFO read is finished (chirps available or error)
+ */
+static bgt60trxxx_data_callback_t data_callback = NULL;
+
+/**
+ * Active radar profile and its FIFO reads (samples_per_read samples, interrupt level)
+ */
+static radar_profile_id_t profile_id = RADAR_PROFILE_DEFAULT;
+static const radar_profile_t* profile = &radar_profiles[RADAR_PROFILE_DEFAULT];
+static uint16_t chirps_per_read = 0;
+static uint32_t samples_per_read = 0;
+
+/**
+ * Frame repetition time set by bgt60trxxx_set_frame_repetition_time (0 -> frame repetition time of the profile)
+ * and the CCR1 register implementing it
+ */
+static float frame_time = 0;
+static uint32_t frame_time_ccr1 = 0;
+
+/**
+ * Frame buffer pool (pool_samples: FIFO read of the largest profile)
+ */
+static frame_slot_t frame_pool[BGT60TRXXX_FRAME_POOL_SIZE];
+static uint32_t pool_samples = 0;
+static uint32_t frame_sequence = 0;
+static frame_slot_t* reading_slot = NULL;
+
+/**
+ * Index inside the frame of the first chirp of the next FIFO read
+ * (the FIFO is emptied at frame start: the reads are aligned on the frames)
+ */
+static uint16_t next_read_chirp = 0;
+
+/**
+ * FIFO error statistics, history[] is a ring buffer (history_next -> next entry written)
+ */
+static bgt60trxxx_fifo_stats_t fifo_stats;
+static uint8_t history_next = 0;
+
+/**
+ * Recovery of the last FIFO error, done by bgt60trxxx_acquire_chirps once recovery_time is reached (backoff)
+ */
+static bool recovery_pending = false;
+static bgt60trxxx_recovery_t recovery_action = BGT60TRXXX_RECOVERY_NONE;
+static uint32_t recovery_time = 0;
+
+/**
+ * SPI clocks tried by the calibration (the first one is BGT60TRXXX_SPI_FREQUENCY)
+ */
+static const uint32_t spi_calibration_frequencies[] = {BGT60TRXXX_SPI_FREQUENCY, 16666667UL, 20000000UL, 25000000UL, 33333333UL, 50000000UL};
+
+/**
+ * Register configuration of each profile encoded once as SPI burst writes (used to reconfigure the sensor)
+ */
+static uint8_t config_streams[RADAR_PROFILE_COUNT][XENSIV_BGT60TRXX_CONFIG_ENCODED_SIZE(RADAR_PROFILE_MAX_REGS)];
+static uint32_t config_stream_sizes[RADAR_PROFILE_COUNT];
+
+/**
+ * @brief Number of chirps per FIFO read of a profile:
+ * largest divisor of the chirps per frame up to BGT60TRXXX_CHIRPS_PER_READ
+ */
+static uint16_t get_profile_chirps_per_read(const radar_profile_t* p)
+{
+	uint16_t chirps = (p->chirps_per_frame < BGT60TRXXX_CHIRPS_PER_READ) ? p->chirps_per_frame : BGT60TRXXX_CHIRPS_PER_READ;
+	while ((p->chirps_per_frame % chirps) != 0)
+	{
+		chirps--;
+	}
+	return chirps;
+}
+
+static uint32_t get_profile_samples_per_read(const radar_profile_t* p)
+{
+	return (uint32_t) p->rx_antennas * get_profile_chirps_per_read(p) * p->samples_per_chirp;
+}
+
+/**
+ * @brief Set the active profile (no FIFO read must be in progress)
+ * The frame repetition time of the profile is used
+ */
+static void select_profile(radar_profile_id_t id)
+{
+	profile_id = id;
+	profile = &radar_profiles[id];
+	chirps_per_read = get_profile_chirps_per_read(profile);
+	samples_per_read = get_profile_samples_per_read(profile);
+	frame_time = 0;
+}
 
-static uint16_t* fifo_data = NULL;
+/**
+ * @brief Value of a register inside the register list of a profile
+ * (each entry is address << 25 | 24 bits data)
+ */
+static int get_profile_register(const radar_profile_t* p, uint32_t address, uint32_t* value)
+{
+	for (uint8_t i = 0; i < p->register_count; ++i)
+	{
+		if ((p->registers[i] >> 25) == address)
+		{
+			*value = p->registers[i] & 0x00FFFFFFUL;
+			return 0;
+		}
+	}
+	return -1;
+}
+
+/**
+ * @brief Compute the CCR1 register giving a frame repetition time to the active profile
+ * The frame itself (chirps, wake up) lasts the frame repetition time of the profile minus its frame end delay:
+ * only the frame end delay changes (the sensor stays in its power down mode meanwhile)
+ */
+static int encode_frame_time(float time, uint32_t* ccr1)
+{
+	uint32_t reg;
+	if (get_profile_register(profile, XENSIV_BGT60TRXX_REG_CCR1, &reg) != 0) return -1;
+
+	const uint32_t tr = (reg & CCR1_TR_FED_MSK) >> CCR1_TR_FED_POS;
+	const uint32_t mul = (reg & CCR1_TR_FED_MUL_MSK) >> CCR1_TR_FED_MUL_POS;
+	const float frame_duration = profile->frame_repetition_time - (float)(tr << mul) * FRAME_END_DELAY_TICK_S;
+
+	const float delay = time - frame_duration;
+	if (delay <= 0) return -1;
+
+	// Smallest multiplier (finest resolution) holding the delay
+	const float ticks = delay / FRAME_END_DELAY_TICK_S;
+	uint32_t new_mul = 0;
+	uint32_t new_tr = (uint32_t)(ticks + 0.5f);
+	while (new_tr > FRAME_END_DELAY_TR_MAX)
+	{
+		new_mul++;
+		if (new_mul > FRAME_END_DELAY_MUL_MAX) return -1;
+		new_tr = (uint32_t)(ticks / (float)(1UL << new_mul) + 0.5f);
+	}
+
+	reg &= ~(CCR1_TR_FED_MSK | CCR1_TR_FED_MUL_MSK);
+	reg |= (new_tr << CCR1_TR_FED_POS) | (new_mul << CCR1_TR_FED_MUL_POS);
+	*ccr1 = reg;
+	return 0;
+}
 
 /**
  * @brief Initializes the SPI communication with the radar sensor
@@ -68,8 +350,8 @@ static int init_spi()
 		return -1;
 	}
 
-	// Set the data rate to spi_freq Mbps
-	if (cyhal_spi_set_frequency(&spi_obj, 12500000UL) != CY_RSLT_SUCCESS)
+	// Set the data rate (tuned by bgt60trxxx_calibrate_spi)
+	if (cyhal_spi_set_frequency(&spi_obj, BGT60TRXXX_SPI_FREQUENCY) != CY_RSLT_SUCCESS)
 	{
 		return -2;
 	}
@@ -77,6 +359,293 @@ static int init_spi()
 	return 0;
 }
 
+/**
+ * @brief Encode the register configuration of each profile once (SPI speed mode of the sensor included)
+ */
+static void encode_config_streams()
+{
+	for (uint8_t i = 0; i < RADAR_PROFILE_COUNT; ++i)
+	{
+		config_stream_sizes[i] = xensiv_bgt60trxx_config_encode(&sensor.dev, radar_profiles[i].registers, radar_profiles[i].register_count, config_streams[i]);
+	}
+}
+
+/**
+ * @brief Change the SPI clock, with the high speed mode of the sensor above BGT60TRXXX_SPI_HS_READ_FREQUENCY
+ * The encoded configurations follow the mode (the reconfigurations keep it)
+ */
+static int set_spi_frequency(uint32_t frequency)
+{
+	const bool high_speed = (frequency > BGT60TRXXX_SPI_HS_READ_FREQUENCY);
+	if (high_speed != sensor.dev.high_speed)
+	{
+		if (xensiv_bgt60trxx_enable_high_speed(&sensor.dev, high_speed) != XENSIV_BGT60TRXX_STATUS_OK) return -1;
+		encode_config_streams();
+	}
+
+	return (cyhal_spi_set_frequency(&spi_obj, frequency) == CY_RSLT_SUCCESS) ? 0 : -1;
+}
+
+/**
+ * @brief Unpack the 12 bits samples in place (the raw data are at the beginning of the buffer)
+ * Backwards: an unpacked sample never overwrites raw bytes not read yet
+ */
+static void unpack_in_place(uint16_t* frame, size_t count)
+{
+	const uint8_t* raw = (const uint8_t*) frame;
+	for (size_t i = count; i-- > 0;)
+	{
+		size_t byteIndex = (i * 3) / 2;
+		uint16_t value;
+		if (i % 2 == 0) {
+			value = ((uint16_t)raw[byteIndex] << 4) | (raw[byteIndex + 1] >> 4);
+		} else {
+			value = ((uint16_t)(raw[byteIndex] & 0x0F) << 8) | raw[byteIndex + 1];
+		}
+		frame[i] = value;
+	}
+}
+
+static void start_fifo_read();
+
+/**
+ * @brief End of the asynchronous FIFO read (SPI interrupt)
+ */
+static void fifo_read_done(void* arg, int32_t status)
+{
+	frame_slot_t* slot = (frame_slot_t*) arg;
+	reading_slot = NULL;
+
+	if (status == XENSIV_BGT60TRXX_STATUS_OK)
+	{
+		// Raw values are available, the consumer gets them using bgt60trxxx_acquire_chirps
+		slot->sequence = frame_sequence++;
+		slot->first_chirp = next_read_chirp;
+		next_read_chirp = (next_read_chirp + chirps_per_read) % profile->chirps_per_frame;
+		slot->state = FRAME_READY;
+	}
+	else
+	{
+		slot->state = FRAME_FREE;
+		read_status = status;
+
+		// No read until the frame generation is restarted by bgt60trxxx_acquire_chirps
+		read_suspended = true;
+	}
+
+	// The FIFO interrupt is a rising edge: none occurs if the FIFO level was reached again during the read
+	// (IRQ line still high), read the next chirps now
+	if (read_pending || cyhal_gpio_read(BGT60TRXXX_IRQ_PIN))
+	{
+		start_fifo_read();
+	}
+
+	if (data_callback != NULL)
+	{
+		data_callback();
+	}
+}
+
+/**
+ * @brief Start the read of the FIFO inside a free frame buffer
+ * Called from the FIFO interrupt, at the end of a read, or when a frame is released
+ * A FIFO interrupt which cannot start a read is remembered (read_pending): the edge is not lost
+ */
+static void start_fifo_read()
+{
+	read_pending = true;
+	if (read_suspended || (reading_slot != NULL)) return;
+
+	frame_slot_t* slot = NULL;
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		if (frame_pool[i].state == FRAME_FREE)
+		{
+			slot = &frame_pool[i];
+			break;
+		}
+	}
+
+	if (slot == NULL)
+	{
+		// All the buffers are used by the consumer
+		return;
+	}
+
+	read_pending = false;
+	slot->state = FRAME_READING;
+	reading_slot = slot;
+
+	// Read the FIFO in the background (the frames of the other buffers can be processed)
+	int32_t retval = xensiv_bgt60trxx_get_fifo_data_async(&sensor.dev, slot->data, samples_per_read, fifo_read_done, slot);
+	if (retval != XENSIV_BGT60TRXX_STATUS_OK)
+	{
+		fifo_read_done(slot, retval);
+	}
+}
+
+/**
+ * @brief Wait for the end of the current FIFO read (the reads must be suspended)
+ * A read not finished after BGT60TRXXX_FIFO_READ_TIMEOUT_US is aborted and counted as a communication error:
+ * the SPI is free in any case when the function returns
+ */
+static void wait_fifo_read()
+{
+	for (uint32_t waited = 0; sensor.dev.fifo_read_busy; ++waited)
+	{
+		if (waited >= BGT60TRXXX_FIFO_READ_TIMEOUT_US)
+		{
+			xensiv_bgt60trxx_abort_fifo_data_async(&sensor.dev);
+			fifo_stats.communication++;
+			return;
+		}
+		CyDelayUs(1);
+	}
+}
+
+/**
+ * @brief Give all the frame buffers back to the pool (no read must be in progress)
+ */
+static void reset_frame_pool()
+{
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		if (frame_pool[i].state != FRAME_ACQUIRED)
+		{
+			frame_pool[i].state = FRAME_FREE;
+		}
+	}
+	read_pending = false;
+	read_status = XENSIV_BGT60TRXX_STATUS_OK;
+	next_read_chirp = 0;
+}
+
+/**
+ * @brief Count a FIFO error, select its recovery and schedule it
+ * Overflows (the consumer is too slow) are recovered by restarting the frame generation only,
+ * the other errors escalate to a soft reset then to a hard reset if they persist
+ */
+static void record_fifo_error(int32_t status, uint32_t gsr0)
+{
+	if (status == XENSIV_BGT60TRXX_STATUS_GSR0_ERROR)
+	{
+		if (gsr0 & XENSIV_BGT60TRXX_REG_GSR0_FOU_ERR_MSK) fifo_stats.fifo_overflow++;
+		if (gsr0 & XENSIV_BGT60TRXX_REG_GSR0_SPI_BURST_ERR_MSK) fifo_stats.spi_burst++;
+		if (gsr0 & XENSIV_BGT60TRXX_REG_GSR0_CLK_NUM_ERR_MSK) fifo_stats.clock_number++;
+	}
+	else
+	{
+		fifo_stats.communication++;
+	}
+	fifo_stats.consecutive_errors++;
+
+	const bool overflow_only = (status == XENSIV_BGT60TRXX_STATUS_GSR0_ERROR)
+			&& ((gsr0 & (XENSIV_BGT60TRXX_REG_GSR0_SPI_BURST_ERR_MSK | XENSIV_BGT60TRXX_REG_GSR0_CLK_NUM_ERR_MSK)) == 0);
+
+	if (overflow_only || (fifo_stats.consecutive_errors <= BGT60TRXXX_RECOVERY_RESTARTS))
+	{
+		recovery_action = BGT60TRXXX_RECOVERY_FRAME_RESTART;
+	}
+	else if (fifo_stats.consecutive_errors <= (BGT60TRXXX_RECOVERY_RESTARTS + BGT60TRXXX_RECOVERY_SOFT_RESETS))
+	{
+		recovery_action = BGT60TRXXX_RECOVERY_SOFT_RESET;
+	}
+	else
+	{
+		recovery_action = BGT60TRXXX_RECOVERY_HARD_RESET;
+	}
+
+	// Exponential backoff
+	uint32_t backoff = BGT60TRXXX_RECOVERY_BACKOFF_US;
+	for (uint32_t i = 1; (i < fifo_stats.consecutive_errors) && (backoff < BGT60TRXXX_RECOVERY_BACKOFF_MAX_US); ++i)
+	{
+		backoff *= 2U;
+	}
+	if (backoff > BGT60TRXXX_RECOVERY_BACKOFF_MAX_US) backoff = BGT60TRXXX_RECOVERY_BACKOFF_MAX_US;
+
+	const uint32_t now = hal_timer_get_uticks();
+	recovery_time = now + backoff;
+	recovery_pending = true;
+
+	bgt60trxxx_fifo_error_t* entry = &fifo_stats.history[history_next];
+	entry->time = now;
+	entry->status = status;
+	entry->gsr0 = gsr0;
+	entry->recovery = recovery_action;
+	history_next = (history_next + 1U) % BGT60TRXXX_FIFO_ERROR_HISTORY;
+	if (fifo_stats.history_count < BGT60TRXXX_FIFO_ERROR_HISTORY) fifo_stats.history_count++;
+}
+
+/**
+ * @brief Recover from the last FIFO error (the FIFO reads are suspended)
+ */
+static void recover_fifo()
+{
+	int retval = 0;
+
+	switch (recovery_action)
+	{
+		case BGT60TRXXX_RECOVERY_SOFT_RESET:
+			fifo_stats.soft_resets++;
+			retval = bgt60trxxx_reconfigure();
+			break;
+		case BGT60TRXXX_RECOVERY_HARD_RESET:
+			fifo_stats.hard_resets++;
+			xensiv_bgt60trxx_hard_reset(&sensor.dev);
+			retval = bgt60trxxx_reconfigure();
+			break;
+		default:
+			// Restart the frame generation (the FIFO is cleared)
+			fifo_stats.frame_restarts++;
+			if (xensiv_bgt60trxx_start_frame(&sensor.dev, false) != XENSIV_BGT60TRXX_STATUS_OK)
+			{
+				retval = -1;
+				break;
+			}
+			reset_frame_pool();
+			read_suspended = false;
+			retval = (xensiv_bgt60trxx_start_frame(&sensor.dev, true) != XENSIV_BGT60TRXX_STATUS_OK) ? -1 : 0;
+			break;
+	}
+
+	recovery_pending = false;
+	if (retval != 0)
+	{
+		// Escalate after the backoff
+		fifo_stats.recovery_failures++;
+		read_suspended = true;
+		record_fifo_error(XENSIV_BGT60TRXX_STATUS_COM_ERROR, 0);
+	}
+}
+
+static int calibration_set_frequency(void* context, uint32_t frequency)
+{
+	CY_UNUSED_PARAMETER(context);
+
+	return set_spi_frequency(frequency);
+}
+
+/**
+ * @brief Read the first chirps of a new frame (data test mode, synchronous read)
+ */
+static int calibration_read_frame(void* context, uint16_t* samples)
+{
+	CY_UNUSED_PARAMETER(context);
+
+	if (xensiv_bgt60trxx_start_frame(&sensor.dev, true) != XENSIV_BGT60TRXX_STATUS_OK) return -1;
+
+	// The next frame starts much later: no overflow
+	CyDelay(CALIBRATION_READ_WAIT_MS);
+	int32_t status = xensiv_bgt60trxx_get_fifo_data(&sensor.dev, samples, samples_per_read);
+
+	// Stop the frame (FIFO cleared, the test words restart with the next frame)
+	if (xensiv_bgt60trxx_start_frame(&sensor.dev, false) != XENSIV_BGT60TRXX_STATUS_OK) return -1;
+	if (status != XENSIV_BGT60TRXX_STATUS_OK) return -1;
+
+	unpack_in_place(samples, samples_per_read);
+	return 0;
+}
+
 #if defined(CYHAL_API_VERSION) && (CYHAL_API_VERSION >= 2)
 void xensiv_bgt60trxx_mtb_interrupt_handler(void *args, cyhal_gpio_event_t event)
 #else
@@ -86,8 +655,8 @@ void xensiv_bgt60trxx_mtb_interrupt_handler(void *args, cyhal_gpio_irq_event_t e
     CY_UNUSED_PARAMETER(args);
     CY_UNUSED_PARAMETER(event);
 
-    // Values are available, then can be read using the function xensiv_bgt60trxx_get_fifo_data
-    data_available = 1;
+    // Values are available
+    start_fifo_read();
 }
 
 int bgt60trxxx_init()
@@ -105,9 +674,23 @@ int bgt60trxxx_init()
 	result = cyhal_gpio_init(ARDU_IO7, CYHAL_GPIO_DIR_OUTPUT, CYHAL_GPIO_DRIVE_OPENDRAINDRIVESLOW, false); /*Keep it OFF*/
 	if (result != CY_RSLT_SUCCESS) return -2;
 
-	// Allocate space
-	fifo_data = malloc((NUM_SAMPLES_PER_FRAME * 12)/8);
-	if (fifo_data == NULL) return -5;
+	// Allocate space (one FIFO read of the largest profile per buffer of the pool)
+	select_profile(RADAR_PROFILE_DEFAULT);
+	pool_samples = 0;
+	for (uint8_t i = 0; i < RADAR_PROFILE_COUNT; ++i)
+	{
+		if (radar_profiles[i].register_count > RADAR_PROFILE_MAX_REGS) return -7;
+
+		const uint32_t samples = get_profile_samples_per_read(&radar_profiles[i]);
+		if (samples > pool_samples) pool_samples = samples;
+	}
+
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		frame_pool[i].data = malloc(pool_samples * sizeof(uint16_t));
+		if (frame_pool[i].data == NULL) return -5;
+		frame_pool[i].state = FRAME_FREE;
+	}
 
 	/*Must wait at least 1ms until the BGT60TR13C sensor power supply gets to nominal value*/
 	CyDelay(200);
@@ -121,15 +704,22 @@ int bgt60trxxx_init()
 			&spi_obj,
 			ARDU_CS,
 			ARDU_IO4,
-			register_list,
-			XENSIV_BGT60TRXX_CONF_NUM_REGS);
+			profile->registers,
+			profile->register_count);
 
 	if (result != CY_RSLT_SUCCESS) return -3;
 
-	// The sensor will generate an interrupt once the sensor FIFO level is NUM_SAMPLES_PER_FRAME
+	for (uint8_t i = 0; i < RADAR_PROFILE_COUNT; ++i)
+	{
+		// Each FIFO read must fit inside the FIFO
+		if ((get_profile_samples_per_read(&radar_profiles[i]) / 2U) > xensiv_bgt60trxx_get_fifo_size(&sensor.dev)) return -7;
+	}
+	encode_config_streams();
+
+	// The sensor will generate an interrupt once the sensor FIFO level is samples_per_read
 	result = xensiv_bgt60trxx_mtb_interrupt_init(&sensor,
-			NUM_SAMPLES_PER_FRAME,
-			ARDU_IO6,
+			samples_per_read,
+			BGT60TRXXX_IRQ_PIN,
 			CYHAL_ISR_PRIORITY_DEFAULT,
 			xensiv_bgt60trxx_mtb_interrupt_handler,
 			NULL);
@@ -141,88 +731,350 @@ int bgt60trxxx_init()
 	return 0;
 }
 
+int bgt60trxxx_reconfigure()
+{
+	// No FIFO read during the reconfiguration (wait for the end of the current one)
+	read_suspended = true;
+	wait_fifo_read();
+
+	// Soft reset and burst writes of the pre-encoded configuration
+	if (xensiv_bgt60trxx_config_encoded(&sensor.dev, config_streams[profile_id], config_stream_sizes[profile_id]) != XENSIV_BGT60TRXX_STATUS_OK) return -1;
+
+	// Frame repetition time changed at runtime
+	if (frame_time != 0)
+	{
+		if (xensiv_bgt60trxx_set_reg(&sensor.dev, XENSIV_BGT60TRXX_REG_CCR1, frame_time_ccr1) != XENSIV_BGT60TRXX_STATUS_OK) return -1;
+	}
+
+	// The soft reset cleared the FIFO limit
+	if (xensiv_bgt60trxx_set_fifo_limit(&sensor.dev, samples_per_read) != XENSIV_BGT60TRXX_STATUS_OK) return -2;
+
+	reset_frame_pool();
+	read_suspended = false;
+	if (xensiv_bgt60trxx_start_frame(&sensor.dev, true) != XENSIV_BGT60TRXX_STATUS_OK) return -3;
+
+	return 0;
+}
+
+int bgt60trxxx_set_profile(uint8_t id)
+{
+	if (id >= RADAR_PROFILE_COUNT) return -1;
+
+	// The buffers owned by the consumer hold chirps of the current profile
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		if (frame_pool[i].state == FRAME_ACQUIRED) return -2;
+	}
+
+	// Stop the frame generation (wait for the end of the current FIFO read)
+	read_suspended = true;
+	wait_fifo_read();
+	xensiv_bgt60trxx_start_frame(&sensor.dev, false);
+
+	// A pending recovery is replaced by the reconfiguration
+	recovery_pending = false;
+
+	const radar_profile_id_t previous = profile_id;
+	select_profile((radar_profile_id_t) id);
+
+	// New registers, FIFO limit of the new profile, frame generation restarted
+	if (bgt60trxxx_reconfigure() != 0)
+	{
+		select_profile(previous);
+		if (bgt60trxxx_reconfigure() == 0) return -3;
+
+		// Sensor in an unknown state: the FIFO recovery (soft, then hard reset) takes over
+		record_fifo_error(XENSIV_BGT60TRXX_STATUS_COM_ERROR, 0);
+		return -4;
+	}
+
+	return 0;
+}
+
+uint8_t bgt60trxxx_get_profile()
+{
+	return profile_id;
+}
+
+int bgt60trxxx_set_frame_repetition_time(float time)
+{
+	uint32_t ccr1 = 0;
+	if (time != 0)
+	{
+		if (encode_frame_time(time, &ccr1) != 0) return -1;
+	}
+	else if (get_profile_register(profile, XENSIV_BGT60TRXX_REG_CCR1, &ccr1) != 0)
+	{
+		return -1;
+	}
+
+	// The buffers owned by the consumer would be reset with the pool
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		if (frame_pool[i].state == FRAME_ACQUIRED) return -2;
+	}
+
+	// Stop the frame generation (wait for the end of the current FIFO read)
+	read_suspended = true;
+	wait_fifo_read();
+	xensiv_bgt60trxx_start_frame(&sensor.dev, false);
+
+	int retval = 0;
+	if (xensiv_bgt60trxx_set_reg(&sensor.dev, XENSIV_BGT60TRXX_REG_CCR1, ccr1) == XENSIV_BGT60TRXX_STATUS_OK)
+	{
+		frame_time = time;
+		frame_time_ccr1 = ccr1;
+	}
+	else
+	{
+		retval = -3;
+	}
+
+	// The new frame starts immediately
+	reset_frame_pool();
+	read_suspended = false;
+	if (xensiv_bgt60trxx_start_frame(&sensor.dev, true) != XENSIV_BGT60TRXX_STATUS_OK) retval = -3;
+
+	return retval;
+}
+
+int bgt60trxxx_calibrate_spi(spi_calibration_result_t* result)
+{
+	if (result == NULL) return -1;
+
+	// Buffer not used by the consumer
+	uint16_t* buffer = NULL;
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		if (frame_pool[i].state != FRAME_ACQUIRED)
+		{
+			buffer = frame_pool[i].data;
+			break;
+		}
+	}
+	if (buffer == NULL) return -2;
+
+	// No FIFO read during the calibration (wait for the end of the current one)
+	read_suspended = true;
+	wait_fifo_read();
+	xensiv_bgt60trxx_start_frame(&sensor.dev, false);
+
+	int retval = -3;
+	if (xensiv_bgt60trxx_enable_data_test_mode(&sensor.dev, true) == XENSIV_BGT60TRXX_STATUS_OK)
+	{
+		const spi_calibration_iface_t iface =
+		{
+			.set_frequency = calibration_set_frequency,
+			.read_frame = calibration_read_frame,
+			.context = NULL,
+		};
+
+		const spi_calibration_param_t params =
+		{
+			.frequencies = spi_calibration_frequencies,
+			.frequency_count = sizeof(spi_calibration_frequencies) / sizeof(spi_calibration_frequencies[0]),
+			.words_per_step = BGT60TRXXX_SPI_CALIBRATION_WORDS,
+			.buffer = buffer,
+			.frame_samples = samples_per_read,
+			.antenna_count = profile->rx_antennas,
+			.margin_steps = BGT60TRXXX_SPI_CALIBRATION_MARGIN,
+		};
+
+		retval = (spi_calibration_run(&iface, &params, result) == 0) ? 0 : -4;
+	}
+
+	// Selected clock, or the default one if the calibration failed
+	set_spi_frequency((retval == 0) ? result->frequency : BGT60TRXXX_SPI_FREQUENCY);
+	if (xensiv_bgt60trxx_enable_data_test_mode(&sensor.dev, false) != XENSIV_BGT60TRXX_STATUS_OK) retval = -3;
+
+	reset_frame_pool();
+	read_suspended = false;
+	if (xensiv_bgt60trxx_start_frame(&sensor.dev, true) != XENSIV_BGT60TRXX_STATUS_OK) return -5;
+
+	return retval;
+}
+
+void bgt60trxxx_set_data_callback(bgt60trxxx_data_callback_t callback)
+{
+	data_callback = callback;
+}
+
 uint16_t bgt60trxxx_is_data_available()
 {
-	if (data_available != 0)
+	if (recovery_pending) return (bgt60trxxx_get_recovery_delay() == 0) ? 1 : 0;
+	if (read_status != XENSIV_BGT60TRXX_STATUS_OK) return 1;
+
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		if (frame_pool[i].state == FRAME_READY) return 1;
+	}
+	return 0;
+}
+
+uint32_t bgt60trxxx_get_recovery_delay()
+{
+	if (!recovery_pending) return 0;
+
+	const int32_t remaining = (int32_t)(recovery_time - hal_timer_get_uticks());
+	return (remaining > 0) ? (uint32_t) remaining : 0;
+}
+
+int bgt60trxxx_acquire_chirps(uint16_t** samples, uint16_t* first_chirp)
+{
+	if (recovery_pending)
 	{
-		data_available = 0;
+		// Wait for the end of the backoff
+		if (bgt60trxxx_get_recovery_delay() != 0) return 1;
+
+		recover_fifo();
 		return 1;
 	}
+
+	if (read_status != XENSIV_BGT60TRXX_STATUS_OK)
+	{
+		// An error occurred when reading the FIFO (no read until the recovery)
+		record_fifo_error(read_status, xensiv_bgt60trxx_get_fifo_read_gsr0(&sensor.dev));
+		read_status = XENSIV_BGT60TRXX_STATUS_OK;
+		return -1;
+	}
+
+	// Oldest filled buffer
+	frame_slot_t* slot = NULL;
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		if ((frame_pool[i].state == FRAME_READY) && ((slot == NULL) || ((int32_t)(frame_pool[i].sequence - slot->sequence) < 0)))
+		{
+			slot = &frame_pool[i];
+		}
+	}
+	if (slot == NULL) return 1;
+
+	slot->state = FRAME_ACQUIRED;
+	fifo_stats.consecutive_errors = 0;
+	unpack_in_place(slot->data, samples_per_read);
+	*samples = slot->data;
+	if (first_chirp != NULL)
+	{
+		*first_chirp = slot->first_chirp;
+	}
 	return 0;
 }
 
+int bgt60trxxx_acquire_frame(uint16_t** frame)
+{
+	// Only possible if a FIFO read contains a complete frame
+	if (chirps_per_read != profile->chirps_per_frame) return -2;
+
+	return bgt60trxxx_acquire_chirps(frame, NULL);
+}
+
+void bgt60trxxx_release_frame(uint16_t* frame)
+{
+	for (uint8_t i = 0; i < BGT60TRXXX_FRAME_POOL_SIZE; ++i)
+	{
+		if ((frame_pool[i].data == frame) && (frame_pool[i].state == FRAME_ACQUIRED))
+		{
+			frame_pool[i].state = FRAME_FREE;
+		}
+	}
+
+	// The FIFO interrupt occurred while all the buffers were used: read now
+	uint32_t saved = cyhal_system_critical_section_enter();
+	if (read_pending)
+	{
+		start_fifo_read();
+	}
+	cyhal_system_critical_section_exit(saved);
+}
+
 uint16_t bgt60trxxx_get_samples_per_frame()
 {
-	return NUM_SAMPLES_PER_FRAME;
+	return profile->rx_antennas * profile->chirps_per_frame * profile->samples_per_chirp;
+}
+
+uint16_t bgt60trxxx_get_chirps_per_read()
+{
+	return chirps_per_read;
 }
 
 uint16_t bgt60trxxx_get_antenna_count()
 {
-	return XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS;
+	return profile->rx_antennas;
 }
 
 uint16_t bgt60trxxx_get_chirps_per_frame()
 {
-	return XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME;
+	return profile->chirps_per_frame;
 }
 
 uint16_t bgt60trxxx_get_samples_per_chirp()
 {
-	return XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP;
+	return profile->samples_per_chirp;
 }
 
 uint64_t bgt60trxxx_get_end_freq()
 {
-	return XENSIV_BGT60TRXX_CONF_END_FREQ_HZ;
+	return profile->end_freq;
 }
 
 uint64_t bgt60trxxx_get_start_freq()
 {
-	return XENSIV_BGT60TRXX_CONF_START_FREQ_HZ;
+	return profile->start_freq;
 }
 
 uint32_t bgt60trxxx_get_sampling_rate()
 {
-	return XENSIV_BGT60TRXX_CONF_SAMPLE_RATE;
+	return profile->sample_rate;
 }
 
-void bits8_to_bits12(uint8_t* raw_readout,
-		uint16_t* out_values, size_t out_size)
+float bgt60trxxx_get_chirp_repetition_time()
 {
-    for (size_t i = 0; i < out_size; i++)
-    {
-        size_t byteIndex = (i * 3) / 2;
-        if (i % 2 == 0) {
-            out_values[i] = ((uint16_t)raw_readout[byteIndex] << 4) |
-                            (raw_readout[byteIndex + 1] >> 4);
-        } else {
-            out_values[i] = ((uint16_t)(raw_readout[byteIndex] & 0x0F) << 8) |
-                            raw_readout[byteIndex + 1];
-        }
-    }
+	return profile->chirp_repetition_time;
+}
+
+float bgt60trxxx_get_frame_repetition_time()
+{
+	return (frame_time != 0) ? frame_time : profile->frame_repetition_time;
 }
 
 int bgt60trxxx_get_data(uint16_t* data)
 {
-	// Get the FIFO data
-	int32_t retval = xensiv_bgt60trxx_get_fifo_data(&sensor.dev, fifo_data, NUM_SAMPLES_PER_FRAME);
-	if (retval == XENSIV_BGT60TRXX_STATUS_OK)
+	// Copy of the oldest buffer of the pool
+	uint16_t* frame;
+	int retval = bgt60trxxx_acquire_chirps(&frame, NULL);
+	if (retval != 0) return -1;
+
+	memcpy(data, frame, samples_per_read * sizeof(uint16_t));
+	bgt60trxxx_release_frame(frame);
+	return 0;
+}
+
+int bgt60trxxx_get_fifo_stats(bgt60trxxx_fifo_stats_t* stats)
+{
+	if (stats == NULL) return -1;
+
+	*stats = fifo_stats;
+
+	// Most recent error first
+	for (uint8_t i = 0; i < fifo_stats.history_count; ++i)
 	{
-		// Convert
-		bits8_to_bits12((uint8_t*)fifo_data, data, NUM_SAMPLES_PER_FRAME);
-		return 0;
+		const uint8_t index = (history_next + BGT60TRXXX_FIFO_ERROR_HISTORY - 1U - i) % BGT60TRXXX_FIFO_ERROR_HISTORY;
+		stats->history[i] = fifo_stats.history[index];
 	}
+	return 0;
+}
 
-	// An error occurred when reading the FIFO
-	// Restart the frame generation
-	xensiv_bgt60trxx_start_frame(&sensor.dev, false);
-	xensiv_bgt60trxx_start_frame(&sensor.dev, true);
-
-	return -1;
+void bgt60trxxx_clear_fifo_stats()
+{
+	memset(&fifo_stats, 0, sizeof(fifo_stats));
+	history_next = 0;
 }
 
 int bgt60trxxx_get_fifo_status(uint32_t* status)
 {
+	// The SPI is used by the FIFO read
+	if (sensor.dev.fifo_read_busy) return -2;
+
 	if ( xensiv_bgt60trxx_get_fifo_status(&sensor.dev, status) != 0)
 	{
 		return -1;
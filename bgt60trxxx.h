@@ -17,16 +17,202 @@
 
 #include <stdint.h>
 
+#include "spi_calibration.h"
+
+/**
+ * @def BGT60TRXXX_FIFO_ERROR_HISTORY
+ * @brief Number of recent FIFO errors kept inside the statistics
+ */
+#define BGT60TRXXX_FIFO_ERROR_HISTORY	8
+
+/**
+ * Recovery of a FIFO error
+ */
+typedef enum
+{
+	BGT60TRXXX_RECOVERY_NONE = 0,
+	BGT60TRXXX_RECOVERY_FRAME_RESTART,	/**< Frame generation stopped and started (FIFO cleared) */
+	BGT60TRXXX_RECOVERY_SOFT_RESET,		/**< Soft reset and reconfiguration */
+	BGT60TRXXX_RECOVERY_HARD_RESET,		/**< Hard reset (reset pin) and reconfiguration */
+} bgt60trxxx_recovery_t;
+
+typedef struct
+{
+	uint32_t time;						/**< Detection time (hal_timer_get_uticks(), us) */
+	int32_t status;						/**< Status of the FIFO read (XENSIV_BGT60TRXX_STATUS_xxx) */
+	uint32_t gsr0;						/**< GSR0 flags of the FIFO read (XENSIV_BGT60TRXX_REG_GSR0_xxx_MSK) */
+	bgt60trxxx_recovery_t recovery;		/**< Recovery selected for this error */
+} bgt60trxxx_fifo_error_t;
+
+/**
+ * FIFO error statistics. An error can have several GSR0 flags (each flag is counted)
+ */
+typedef struct
+{
+	uint32_t fifo_overflow;			/**< GSR0 FOU_ERR: the FIFO was not read in time (processing too slow) */
+	uint32_t spi_burst;				/**< GSR0 SPI_BURST_ERR: burst read error (SPI glitch) */
+	uint32_t clock_number;			/**< GSR0 CLK_NUM_ERR: wrong number of SPI clock cycles (SPI glitch) */
+	uint32_t communication;			/**< SPI transfer failure or failed recovery (no GSR0 flags) */
+
+	uint32_t frame_restarts;
+	uint32_t soft_resets;
+	uint32_t hard_resets;
+	uint32_t recovery_failures;		/**< Soft or hard reset failed (escalated) */
+	uint32_t consecutive_errors;	/**< Errors since the last valid FIFO read (selects the recovery and the backoff) */
+
+	bgt60trxxx_fifo_error_t history[BGT60TRXXX_FIFO_ERROR_HISTORY];	/**< Most recent error first */
+	uint8_t history_count;
+} bgt60trxxx_fifo_stats_t;
+
+/**
+ * @brief Initialize the radar sensor and start the frame generation (RADAR_PROFILE_DEFAULT)
+ * hal_timer must be initialized (time of the FIFO errors and recovery backoff)
+ */
 int bgt60trxxx_init();
 
+/**
+ * @brief Apply the register configuration again (soft reset, SPI burst writes) and restart the frame generation
+ */
+int bgt60trxxx_reconfigure();
+
+/**
+ * @brief Switch to another radar profile without reboot (radar_profiles.h)
+ * The frame generation is stopped, the registers of the profile are written (soft reset, SPI burst writes),
+ * the FIFO limit is set for the chirps per read of the profile and the frame generation is restarted
+ * The bgt60trxxx_get_xxx functions return the configuration of the new profile (e.g. to reconfigure the detection)
+ *
+ * @param [in] id	radar_profile_id_t
+ *
+ * @retval 0 Success
+ * @retval -1 Invalid profile
+ * @retval -2 A buffer is owned by the consumer (release it first)
+ * @retval -3 Reconfiguration failed, the previous profile is restored
+ * @retval -4 Reconfiguration and restoration of the previous profile failed, a FIFO recovery is scheduled
+ */
+int bgt60trxxx_set_profile(uint8_t id);
+
+/**
+ * @brief Active radar profile (radar_profile_id_t)
+ */
+uint8_t bgt60trxxx_get_profile();
+
+/**
+ * @brief Change the frame repetition time of the active profile (e.g. lower frame rate while the scene is empty)
+ * Only the frame end delay of the sensor changes: the chirps are the same and the sensor stays in its
+ * power down mode between the frames. The frame generation is restarted, the next frame starts immediately
+ * Kept by the reconfigurations (FIFO error recovery), bgt60trxxx_set_profile restores the time of the profile
+ *
+ * @param [in] time	Frame repetition time in seconds, 0 -> frame repetition time of the profile
+ *
+ * @retval 0 Success
+ * @retval -1 Time shorter than the frame or longer than the maximum frame end delay
+ * @retval -2 A buffer is owned by the consumer (release it first)
+ * @retval -3 Register write or frame restart failed
+ */
+int bgt60trxxx_set_frame_repetition_time(float time);
+
+/**
+ * @brief Select the fastest reliable SPI clock (shorter FIFO reads)
+ * The sensor outputs test words (data test mode), the SPI clock is stepped up and the words received
+ * at each clock are checked. The clock is set margin steps below the first clock with errors
+ * Above BGT60TRXXX_SPI_HS_READ_FREQUENCY (25 MHz) the high speed mode of the sensor (MISO_HS_READ) is enabled
+ * The frame generation is restarted (the frames owned by the consumer stay valid)
+ *
+ * @param [out] result	Bit error rate of each clock and selected clock
+ *
+ * @retval 0 Success
+ * @retval -1 Invalid result
+ * @retval -2 No buffer available
+ * @retval -3 Cannot enable or disable the data test mode
+ * @retval -4 No error-free clock, BGT60TRXXX_SPI_FREQUENCY is kept
+ * @retval -5 Cannot restart the frame generation
+ */
+int bgt60trxxx_calibrate_spi(spi_calibration_result_t* result);
+
+/**
+ * @brief Function called from the interrupt once a FIFO read is finished (chirps available or FIFO error)
+ */
+typedef void (*bgt60trxxx_data_callback_t)(void);
+
+/**
+ * @brief Get notified when bgt60trxxx_is_data_available() becomes true (wake up an event-driven main loop)
+ */
+void bgt60trxxx_set_data_callback(bgt60trxxx_data_callback_t callback);
+
+/**
+ * @brief Chirps, a FIFO error or a recovery to process by bgt60trxxx_acquire_chirps
+ * Returns 0 during the recovery backoff (see bgt60trxxx_get_recovery_delay)
+ */
 uint16_t bgt60trxxx_is_data_available();
 
+/**
+ * @brief Time left until the pending recovery in us (0 -> no recovery pending or recovery due)
+ * The end of the backoff is not notified by the data callback: wake up after this delay
+ */
+uint32_t bgt60trxxx_get_recovery_delay();
+
+/**
+ * @brief Copy the oldest filled buffer (the buffer goes back to the pool)
+ * Size of data: bgt60trxxx_get_chirps_per_read() chirps
+ *
+ * @retval 0 Success
+ * @retval -1 No frame, or FIFO error (recovered by bgt60trxxx_acquire_chirps)
+ */
 int bgt60trxxx_get_data(uint16_t* data);
 
+/**
+ * @brief Get the ownership of the oldest FIFO read (no copy)
+ * The FIFO reads continue inside the other buffers of the pool until the buffer is released
+ * After a FIFO error, the recovery (frame restart, soft reset or hard reset depending on the
+ * consecutive errors) is done by this function once the backoff delay is elapsed
+ *
+ * @param [out] samples	bgt60trxxx_get_chirps_per_read() chirps (same layout as a frame)
+ * @param [out] first_chirp	Index inside the frame of the first chirp (can be NULL)
+ *
+ * @retval 0 Success
+ * @retval 1 No chirps available (or recovery in progress)
+ * @retval -1 FIFO error, recorded inside the statistics (the next chirps start a new frame)
+ */
+int bgt60trxxx_acquire_chirps(uint16_t** samples, uint16_t* first_chirp);
+
+/**
+ * @brief Get the ownership of the oldest filled frame (no copy)
+ * Same as bgt60trxxx_acquire_chirps when a FIFO read contains a complete frame
+ *
+ * @param [out] frame	Samples of the frame (bgt60trxxx_get_samples_per_frame() values)
+ *
+ * @retval 0 Success
+ * @retval 1 No frame available
+ * @retval -1 FIFO error (see bgt60trxxx_acquire_chirps)
+ * @retval -2 Streaming (bgt60trxxx_get_chirps_per_read() < chirps per frame), use bgt60trxxx_acquire_chirps
+ */
+int bgt60trxxx_acquire_frame(uint16_t** frame);
+
+/**
+ * @brief Give a buffer obtained with bgt60trxxx_acquire_chirps or bgt60trxxx_acquire_frame back to the pool
+ */
+void bgt60trxxx_release_frame(uint16_t* frame);
+
 int bgt60trxxx_get_fifo_status(uint32_t* status);
 
+/**
+ * @brief Get the FIFO error statistics
+ *
+ * @retval 0 Success
+ * @retval -1 Invalid stats
+ */
+int bgt60trxxx_get_fifo_stats(bgt60trxxx_fifo_stats_t* stats);
+
+void bgt60trxxx_clear_fifo_stats();
+
 uint16_t bgt60trxxx_get_samples_per_frame();
 
+/**
+ * @brief Number of chirps per FIFO read of the active profile
+ * (largest divisor of the chirps per frame up to BGT60TRXXX_CHIRPS_PER_READ)
+ */
+uint16_t bgt60trxxx_get_chirps_per_read();
+
 uint16_t bgt60trxxx_get_antenna_count();
 
 uint16_t bgt60trxxx_get_chirps_per_frame();
@@ -39,4 +225,11 @@ uint64_t bgt60trxxx_get_start_freq();
 
 uint32_t bgt60trxxx_get_sampling_rate();
 
+float bgt60trxxx_get_chirp_repetition_time();
+
+/**
+ * @brief Frame repetition time in seconds (bgt60trxxx_set_frame_repetition_time, or the one of the profile)
+ */
+float bgt60trxxx_get_frame_repetition_time();
+
 #endif /* BGT60TRXXX_H_ */
@@ -0,0 +1,161 @@
+/*
+ * duty_cycle.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "duty_cycle.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * Sensor access
+ */
+static const duty_cycle_iface_t* iface = NULL;
+static duty_cycle_param_t params;
+
+static duty_cycle_mode_t mode = DUTY_CYCLE_ACTIVE;
+
+/**
+ * Consecutive empty frames at the active frame time
+ */
+static uint16_t empty_frames = 0;
+
+/**
+ * Time of the idle frame that suspected a presence (wake up in progress until the next frame)
+ */
+static bool wake_pending = false;
+static uint32_t wake_time = 0;
+
+static duty_cycle_stats_t stats;
+static uint32_t last_time = 0;
+
+/**
+ * @brief Accumulate the time elapsed since the last frame inside the current mode
+ */
+static void update_time(uint32_t now)
+{
+	const uint32_t elapsed = now - last_time;
+	last_time = now;
+
+	if (mode == DUTY_CYCLE_ACTIVE)
+	{
+		stats.active_time += elapsed;
+		stats.active_frames++;
+	}
+	else
+	{
+		stats.idle_time += elapsed;
+		stats.idle_frames++;
+	}
+}
+
+static int set_mode(duty_cycle_mode_t new_mode)
+{
+	const float frame_time = (new_mode == DUTY_CYCLE_ACTIVE) ? params.active_frame_time : params.idle_frame_time;
+	if (iface->set_frame_time(iface->context, frame_time) != 0)
+	{
+		stats.errors++;
+		return -1;
+	}
+
+	mode = new_mode;
+	stats.mode = new_mode;
+	empty_frames = 0;
+	return 1;
+}
+
+int duty_cycle_init(const duty_cycle_iface_t* iface_hooks, const duty_cycle_param_t* parameters)
+{
+	if ((iface_hooks == NULL) || (iface_hooks->set_frame_time == NULL) || (iface_hooks->get_time == NULL)) return -1;
+	if ((parameters == NULL) || (parameters->active_frame_time <= 0)) return -1;
+	if (parameters->idle_frame_time < parameters->active_frame_time) return -1;
+
+	iface = iface_hooks;
+	params = *parameters;
+	wake_pending = false;
+	duty_cycle_reset_stats();
+
+	if (set_mode(DUTY_CYCLE_ACTIVE) < 0) return -2;
+
+	return 0;
+}
+
+int duty_cycle_update(bool presence)
+{
+	if (iface == NULL) return 0;
+
+	const uint32_t now = iface->get_time();
+	update_time(now);
+
+	// First frame at the active frame time after a wake up
+	if (wake_pending && (mode == DUTY_CYCLE_ACTIVE))
+	{
+		stats.wake_latency = now - wake_time;
+		if (stats.wake_latency > stats.max_wake_latency) stats.max_wake_latency = stats.wake_latency;
+		wake_pending = false;
+	}
+
+	if (presence)
+	{
+		empty_frames = 0;
+		if (mode == DUTY_CYCLE_IDLE)
+		{
+			// Ramp up immediately (the frame generation restarts, the next frame starts now)
+			if (!wake_pending)
+			{
+				wake_time = now;
+				wake_pending = true;
+			}
+
+			int retval = set_mode(DUTY_CYCLE_ACTIVE);
+			if (retval > 0) stats.wakeups++;
+			return retval;
+		}
+		return 0;
+	}
+
+	if (mode == DUTY_CYCLE_ACTIVE)
+	{
+		if (++empty_frames < params.idle_frames) return 0;
+
+		int retval = set_mode(DUTY_CYCLE_IDLE);
+		if (retval > 0) stats.sleeps++;
+		return retval;
+	}
+
+	return 0;
+}
+
+duty_cycle_mode_t duty_cycle_get_mode()
+{
+	return mode;
+}
+
+void duty_cycle_get_stats(duty_cycle_stats_t* result)
+{
+	if (result == NULL) return;
+
+	*result = stats;
+}
+
+void duty_cycle_reset_stats()
+{
+	memset(&stats, 0, sizeof(stats));
+	stats.mode = mode;
+	stats.active_frame_time = params.active_frame_time;
+	stats.idle_frame_time = params.idle_frame_time;
+	if (iface != NULL)
+	{
+		last_time = iface->get_time();
+	}
+}
@@ -0,0 +1,101 @@
+/*
+ * duty_cycle.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef DUTY_CYCLE_H_
+#define DUTY_CYCLE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Frame rate selected by the controller
+ */
+typedef enum
+{
+	DUTY_CYCLE_ACTIVE = 0,		/**< Someone may be there: active frame time (full response time) */
+	DUTY_CYCLE_IDLE,			/**< Empty scene: idle frame time (less frames to read and to process) */
+} duty_cycle_mode_t;
+
+/**
+ * Access to the sensor (hardware or simulated device)
+ */
+typedef struct
+{
+	/**< Change the frame repetition time (seconds). Returns 0 on success */
+	int (*set_frame_time)(void* context, float frame_time);
+
+	/**< Free running time in us (wraps around) */
+	uint32_t (*get_time)(void);
+
+	void* context;
+} duty_cycle_iface_t;
+
+typedef struct
+{
+	float active_frame_time;	/**< Frame repetition time while a presence is suspected or confirmed (seconds) */
+	float idle_frame_time;		/**< Frame repetition time of an empty scene (seconds, >= active_frame_time) */
+	uint16_t idle_frames;		/**< Consecutive empty frames at the active frame time before the idle frame time is used */
+} duty_cycle_param_t;
+
+typedef struct
+{
+	duty_cycle_mode_t mode;
+	float active_frame_time;		/**< Configured frame repetition times (seconds) */
+	float idle_frame_time;
+
+	uint32_t wakeups;				/**< Switches to the active frame time */
+	uint32_t sleeps;				/**< Switches to the idle frame time */
+	uint32_t errors;				/**< Failed frame time changes */
+
+	uint32_t wake_latency;			/**< Time between the idle frame that suspected a presence and the first frame
+									 * at the active frame time (us, last wake up). The response time to an entry is
+									 * at most idle_frame_time + wake_latency + confirmation frames at the active rate */
+	uint32_t max_wake_latency;		/**< Longest wake_latency (us) */
+
+	uint64_t active_time;			/**< Time spent at each frame time (us) */
+	uint64_t idle_time;
+	uint32_t active_frames;			/**< Frames processed at each frame time */
+	uint32_t idle_frames;
+} duty_cycle_stats_t;
+
+/**
+ * @brief Start the controller at the active frame time (set through the interface)
+ *
+ * @retval 0 Success
+ * @retval -1 Invalid interface or parameters
+ * @retval -2 Cannot set the active frame time
+ */
+int duty_cycle_init(const duty_cycle_iface_t* iface, const duty_cycle_param_t* params);
+
+/**
+ * @brief Update the controller after each processed frame
+ * Any presence (candidate, present or holding in any zone) selects the active frame time immediately,
+ * idle_frames consecutive empty frames select the idle frame time
+ * Changing the frame time restarts the frame generation: call it when no frame is owned
+ *
+ * @param [in] presence	True if a presence is suspected or confirmed after this frame
+ *
+ * @retval 1 Frame time changed
+ * @retval 0 No change
+ * @retval -1 Cannot change the frame time (retried with the next frame)
+ */
+int duty_cycle_update(bool presence);
+
+duty_cycle_mode_t duty_cycle_get_mode();
+
+void duty_cycle_get_stats(duty_cycle_stats_t* stats);
+
+void duty_cycle_reset_stats();
+
+#endif /* DUTY_CYCLE_H_ */
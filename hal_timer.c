@@ -9,6 +9,15 @@
 #include "cyhal_timer.h"
 
 static cyhal_timer_t Systick_obj;
+static cyhal_timer_t Alarm_obj;
+
+static void alarm_handler(void *callback_arg, cyhal_timer_event_t event)
+{
+	CY_UNUSED_PARAMETER(callback_arg);
+	CY_UNUSED_PARAMETER(event);
+
+	// Wake-up only
+}
 
 int hal_timer_init()
 {
@@ -28,6 +37,12 @@ int hal_timer_init()
 	cyhal_timer_set_frequency(&Systick_obj, 1000000);
 	cyhal_timer_start(&Systick_obj);
 
+	// One-shot alarm, same clock
+	if (cyhal_timer_init(&Alarm_obj, NC, NULL) != CY_RSLT_SUCCESS) return -1;
+	if (cyhal_timer_set_frequency(&Alarm_obj, 1000000) != CY_RSLT_SUCCESS) return -1;
+	cyhal_timer_register_callback(&Alarm_obj, alarm_handler, NULL);
+	cyhal_timer_enable_event(&Alarm_obj, CYHAL_TIMER_IRQ_TERMINAL_COUNT, CYHAL_ISR_PRIORITY_DEFAULT, true);
+
 	return 0;
 }
 
@@ -36,4 +51,17 @@ uint32_t hal_timer_get_uticks(void)
 	return cyhal_timer_read(&Systick_obj);
 }
 
+void hal_timer_set_alarm(uint32_t delay)
+{
+	cyhal_timer_cfg_t Alarm_cfg;
+	Alarm_cfg.compare_value = 0;
+	Alarm_cfg.period = (delay > 0) ? delay : 1;
+	Alarm_cfg.direction = CYHAL_TIMER_DIR_UP;
+	Alarm_cfg.is_compare = false;
+	Alarm_cfg.is_continuous = false;
+	Alarm_cfg.value = 0;
 
+	cyhal_timer_stop(&Alarm_obj);
+	cyhal_timer_configure(&Alarm_obj, &Alarm_cfg);
+	cyhal_timer_start(&Alarm_obj);
+}
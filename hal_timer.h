@@ -15,5 +15,10 @@ int hal_timer_init();
 
 uint32_t hal_timer_get_uticks(void);
 
+/**
+ * @brief One-shot interrupt in delay us (replaces the previous one), wakes the CPU up from sleep
+ */
+void hal_timer_set_alarm(uint32_t delay);
+
 
 #endif /* HAL_TIMER_H_ */
@@ -57,6 +57,7 @@
 #include "cy_retarget_io.h"
 
 #include "bgt60trxxx.h"
+#include "radar_profiles.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -65,13 +66,255 @@
 #include "presence_detection/presence_detection.h"
 
 #include "hal_timer.h"
+#include "scheduler.h"
+#include "duty_cycle.h"
+
+/**
+ * Events of the scheduler
+ */
+#define EVENT_RADAR_DATA	(1UL << 0)
+
+/**
+ * Number of frames between two idle time reports
+ */
+#define IDLE_REPORT_FRAMES	100
+
+/**
+ * Frame repetition time while the scene is empty (seconds)
+ */
+#define EMPTY_FRAME_TIME_S	1.f
+
+/**
+ * Empty frames at the frame rate of the profile before the empty frame time is used
+ */
+#define EMPTY_FRAMES		10
 
 
 void handle_error(void);
 
-void presence_detection_listener(float magnitude, uint16_t bin, float angle)
+static uint32_t platform_critical_enter(void)
+{
+	return cyhal_system_critical_section_enter();
+}
+
+static void platform_critical_exit(uint32_t state)
+{
+	cyhal_system_critical_section_exit(state);
+}
+
+/**
+ * CPU sleep: the timer and the SPI (FIFO reads in the background) keep running, the FIFO interrupt
+ * and the alarm of the delayed events (recovery backoff) wake the CPU up
+ */
+static void platform_sleep(void)
+{
+	cyhal_syspm_sleep();
+}
+
+static const scheduler_platform_t scheduler_platform =
+{
+	.get_time = hal_timer_get_uticks,
+	.critical_enter = platform_critical_enter,
+	.critical_exit = platform_critical_exit,
+	.sleep = platform_sleep,
+	.set_alarm = hal_timer_set_alarm,
+};
+
+static void radar_data_available(void)
+{
+	scheduler_post(EVENT_RADAR_DATA);
+}
+
+static int duty_cycle_set_frame_time(void* context, float frame_time)
+{
+	CY_UNUSED_PARAMETER(context);
+
+	int retval = bgt60trxxx_set_frame_repetition_time(frame_time);
+	if (retval != 0) return retval;
+
+	// Slow-time processing (vital signs) at the new frame rate
+	return presence_detection_set_frame_repetition_time(frame_time);
+}
+
+static const duty_cycle_iface_t duty_cycle_iface =
+{
+	.set_frame_time = duty_cycle_set_frame_time,
+	.get_time = hal_timer_get_uticks,
+	.context = NULL,
+};
+
+/**
+ * @brief Lower the frame rate while the scene is empty (frame rate of the active profile otherwise)
+ */
+static int start_duty_cycle(void)
 {
-	printf("Presence detected. Mag: %1.1f - Distance: %1.1f \r\n", magnitude, presence_detection_bin_to_meters(bin));
+	duty_cycle_param_t duty_cycle_params;
+	duty_cycle_params.active_frame_time = radar_profiles[bgt60trxxx_get_profile()].frame_repetition_time;
+	duty_cycle_params.idle_frame_time = (duty_cycle_params.active_frame_time < EMPTY_FRAME_TIME_S) ? EMPTY_FRAME_TIME_S : duty_cycle_params.active_frame_time;
+	duty_cycle_params.idle_frames = EMPTY_FRAMES;
+
+	int retval = duty_cycle_init(&duty_cycle_iface, &duty_cycle_params);
+	if (retval != 0)
+	{
+		printf("duty_cycle_init error: %d \r\n", retval);
+	}
+	return retval;
+}
+
+/**
+ * @brief Configuration of the active radar profile
+ */
+static void get_radar_configuration(radar_configuration_t* radar_configuration)
+{
+	radar_configuration->antenna_count = bgt60trxxx_get_antenna_count();
+	radar_configuration->chirps_per_frame = bgt60trxxx_get_chirps_per_frame();
+	radar_configuration->samples_per_chirp = bgt60trxxx_get_samples_per_chirp();
+	radar_configuration->start_freq = bgt60trxxx_get_start_freq();
+	radar_configuration->end_freq = bgt60trxxx_get_end_freq();
+	radar_configuration->sampling_rate = bgt60trxxx_get_sampling_rate();
+	radar_configuration->chirp_repetition_time = bgt60trxxx_get_chirp_repetition_time();
+	radar_configuration->frame_repetition_time = bgt60trxxx_get_frame_repetition_time();
+}
+
+/**
+ * @brief Switch the radar profile and reinitialize the presence detection in place
+ * No buffer of the radar module must be owned
+ */
+static int switch_radar_profile(uint8_t profile)
+{
+	const uint8_t previous_profile = bgt60trxxx_get_profile();
+	int retval = bgt60trxxx_set_profile(profile);
+	if (retval != 0)
+	{
+		printf("Cannot switch to radar profile %d: %d \r\n", profile, retval);
+		return -1;
+	}
+
+	radar_configuration_t radar_configuration;
+	get_radar_configuration(&radar_configuration);
+	retval = presence_detection_set_radar_configuration(radar_configuration);
+	if (retval != 0)
+	{
+		printf("presence_detection_set_radar_configuration error: %d \r\n", retval);
+
+		// Back to the previous profile (until then presence_detection_feed_chirps rejects the chirps)
+		if (bgt60trxxx_set_profile(previous_profile) == 0)
+		{
+			get_radar_configuration(&radar_configuration);
+			if (presence_detection_set_radar_configuration(radar_configuration) == 0)
+			{
+				start_duty_cycle();
+				return -2;
+			}
+		}
+		printf("Cannot restore radar profile %d: presence detection stopped \r\n", previous_profile);
+		return -3;
+	}
+
+	printf("Radar profile: %s \r\n", radar_profiles[profile].name);
+	return start_duty_cycle();
+}
+
+void presence_detection_listener(const presence_detection_event_t* event)
+{
+	switch(event->state)
+	{
+		case PRESENCE_STATE_PRESENT:
+			if (event->previous_state == PRESENCE_STATE_HOLDING) return; // Still present
+			break;
+		case PRESENCE_STATE_ABSENT:
+			if (event->previous_state == PRESENCE_STATE_CANDIDATE) return; // Presence never confirmed
+			printf("Zone %d: absence detected. \r\n", event->zone);
+			return;
+		default:
+			return;
+	}
+
+	const vital_signs_result_t* vital_signs = presence_detection_get_vital_signs();
+	if ((vital_signs != NULL) && vital_signs->valid)
+	{
+		printf("Zone %d: presence detected. Mag: %1.1f - Distance: %1.2f - Respiration: %1.1f bpm \r\n", event->zone, event->peak.magnitude, event->peak.distance, vital_signs->respiration_rate);
+		return;
+	}
+	printf("Zone %d: presence detected. Mag: %1.1f - Distance: %1.2f \r\n", event->zone, event->peak.magnitude, event->peak.distance);
+}
+
+/**
+ * @brief Process the chirps (the next ones are read by the radar module meanwhile)
+ * Range FFT as the chirps arrive, detection once the frame is complete
+ */
+static void radar_task(uint32_t events)
+{
+	static uint32_t frame_count = 0;
+	static bool button_pressed = false;
+	CY_UNUSED_PARAMETER(events);
+
+	uint16_t* chirps;
+	uint16_t first_chirp;
+	int retval = bgt60trxxx_acquire_chirps(&chirps, &first_chirp);
+	if (retval == 0)
+	{
+		cyhal_gpio_write(LED2, CYBSP_LED_STATE_ON);
+		retval = presence_detection_feed_chirps(chirps, first_chirp, bgt60trxxx_get_chirps_per_read());
+		cyhal_gpio_write(LED2, CYBSP_LED_STATE_OFF);
+		bgt60trxxx_release_frame(chirps);
+
+		if (retval == 1)
+		{
+			cyhal_gpio_toggle(LED1);
+
+			// Full frame rate as soon as a zone is not empty
+			bool presence = false;
+			for (uint8_t zone = 0; zone < presence_detection_get_zone_count(); ++zone)
+			{
+				if (presence_detection_get_state(zone) != PRESENCE_STATE_ABSENT) presence = true;
+			}
+			duty_cycle_update(presence);
+
+			// Headroom left by the processing
+			if (++frame_count == IDLE_REPORT_FRAMES)
+			{
+				scheduler_stats_t stats;
+				scheduler_get_stats(&stats);
+				duty_cycle_stats_t duty_stats;
+				duty_cycle_get_stats(&duty_stats);
+				printf("Idle: %.1f %% - Frame time: %.2f s - Wake latency: %lu us (max %lu us) \r\n", stats.idle_percent,
+						(duty_stats.mode == DUTY_CYCLE_ACTIVE) ? duty_stats.active_frame_time : duty_stats.idle_frame_time,
+						(unsigned long) duty_stats.wake_latency, (unsigned long) duty_stats.max_wake_latency);
+				scheduler_reset_stats();
+				frame_count = 0;
+			}
+
+			// USER_BTN1 (active low) switches to the next radar profile between two frames
+			const bool pressed = (cyhal_gpio_read(USER_BTN1) == false);
+			if (pressed && !button_pressed)
+			{
+				switch_radar_profile((bgt60trxxx_get_profile() + 1) % RADAR_PROFILE_COUNT);
+			}
+			button_pressed = pressed;
+		}
+	}
+	else if (retval < 0)
+	{
+		// Overflow -> processing too slow, SPI burst / clock number -> SPI glitches
+		bgt60trxxx_fifo_stats_t stats;
+		bgt60trxxx_get_fifo_stats(&stats);
+		printf("FIFO error - Overflow: %lu - SPI burst: %lu - Clock number: %lu - SPI: %lu (resets: %lu soft, %lu hard) \r\n",
+				(unsigned long) stats.fifo_overflow, (unsigned long) stats.spi_burst, (unsigned long) stats.clock_number,
+				(unsigned long) stats.communication, (unsigned long) stats.soft_resets, (unsigned long) stats.hard_resets);
+	}
+
+	// Recovery waiting for its backoff: sleep until its deadline
+	const uint32_t recovery_delay = bgt60trxxx_get_recovery_delay();
+	if (recovery_delay != 0)
+	{
+		scheduler_post_delayed(EVENT_RADAR_DATA, recovery_delay);
+	}
+	// Other buffers filled meanwhile, or recovery due
+	else if (bgt60trxxx_is_data_available())
+	{
+		scheduler_post(EVENT_RADAR_DATA);
+	}
 }
 
 /*******************************************************************************
@@ -92,7 +335,6 @@ void presence_detection_listener(float magnitude, uint16_t bin, float angle)
 int main(void)
 {
     cy_rslt_t result = CY_RSLT_SUCCESS;
-    uint16_t * samples = NULL;
     presence_detection_param_t params;
     radar_configuration_t radar_configuration;
     int retval = 0;
@@ -138,20 +380,25 @@ int main(void)
     	for(;;){}
     }
 
-    // Init samples
-    samples = custom_malloc(bgt60trxxx_get_samples_per_frame() * sizeof(uint16_t));
-
     // Init presence detection algorithm
-    params.threshold = 0.2;
+    params.threshold = 0.56; // Magnitudes normalized by the coherent gain of the windows
+    params.threshold_exit = 0.42;
+    params.confirm_frames = 3;	// 300ms
+    params.hold_frames = 50;	// 5s
     params.bin_start = 0;
     params.bin_end = 0; // bin_start = bin_end -> complete range
+    params.zones = NULL; // Single zone defined by bin_start, bin_end and the thresholds
+    params.zone_count = 0;
+    params.slow_time_history = 1; // The vital-sign estimation only reads the sample of the current frame
+    params.vital_signs = true;
+    params.arithmetic = PRESENCE_DETECTION_ARITHMETIC_FLOAT; // PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT halves the range buffer
+    params.range_cube_format = RANGE_CUBE_FORMAT_FLOAT32; // RANGE_CUBE_FORMAT_FLOAT16 / RANGE_CUBE_FORMAT_BFP16 halve the range buffer
+    params.range_zoom = 1; // > 1: finer range grid computed only inside the region of interest
+    params.range_fft_padding = 1; // 2, 4...: zero-padded range FFT (finer range grid)
+    params.range_window = WINDOW_BLACKMAN_HARRIS;
+    params.doppler_window = WINDOW_NONE;
 
-    radar_configuration.antenna_count = bgt60trxxx_get_antenna_count();
-    radar_configuration.chirps_per_frame = bgt60trxxx_get_chirps_per_frame();
-    radar_configuration.samples_per_chirp = bgt60trxxx_get_samples_per_chirp();
-    radar_configuration.start_freq = bgt60trxxx_get_start_freq();
-    radar_configuration.end_freq = bgt60trxxx_get_end_freq();
-    radar_configuration.sampling_rate = bgt60trxxx_get_sampling_rate();
+    get_radar_configuration(&radar_configuration);
 
     presence_detection_set_malloc_free(custom_malloc, custom_free);
     presence_detection_set_listener(presence_detection_listener);
@@ -162,6 +409,10 @@ int main(void)
     	handle_error();
     }
 
+    scheduler_init(&scheduler_platform);
+    scheduler_add_task(radar_task, EVENT_RADAR_DATA);
+    bgt60trxxx_set_data_callback(radar_data_available);
+
     printf("Initialize radar sensor\r\n");
 
     // Start frame generation
@@ -174,26 +425,39 @@ int main(void)
     	for(;;){}
     }
 
+    // Fastest reliable SPI clock (shorter FIFO reads)
+    spi_calibration_result_t calibration;
+    bgtret = bgt60trxxx_calibrate_spi(&calibration);
+    if (bgtret != -1)
+    {
+    	for (uint8_t i = 0; i < calibration.step_count; ++i)
+    	{
+    		const spi_calibration_step_t* step = &calibration.steps[i];
+    		if (step->status == SPI_CALIBRATION_STEP_NOT_TESTED) break;
+    		printf("SPI %5.2f MHz: %d - BER: %.2e (%lu words) \r\n", step->frequency / 1e6f, step->status, step->bit_error_rate, (unsigned long) step->words);
+    	}
+    }
+    if (bgtret != 0)
+    {
+    	printf("SPI calibration error: %d \r\n", bgtret);
+    }
+    else
+    {
+    	printf("SPI clock: %5.2f MHz \r\n", calibration.frequency / 1e6f);
+    }
+
+    // Lower frame rate while nobody is there
+    start_duty_cycle();
+
     printf("Ok, radar initialized - Start measurement \r\n");
 
     cyhal_gpio_write(LED1, CYBSP_LED_STATE_OFF);
     cyhal_gpio_write(LED2, CYBSP_LED_STATE_OFF);
 
-    for(;;)
-    {
-    	// Read and send over USB
-    	if (bgt60trxxx_is_data_available())
-    	{
-    		retval = bgt60trxxx_get_data(samples);
-    		if (retval == 0)
-    		{
-    			cyhal_gpio_write(LED2, CYBSP_LED_STATE_ON);
-    			presence_detection_feed(samples);
-    			cyhal_gpio_write(LED2, CYBSP_LED_STATE_OFF);
-    		}
-    		cyhal_gpio_toggle(LED1);
-    	}
-    }
+    // Sleep until the FIFO reads, process the chirps as a task
+    scheduler_post(EVENT_RADAR_DATA);
+    scheduler_reset_stats();
+    scheduler_run();
 }
 
 void handle_error(void)
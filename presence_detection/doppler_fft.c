@@ -13,11 +13,34 @@
  */
 
 #include "doppler_fft.h"
+#include "fft_plan_cache.h"
+
+/**
+ * @def PRESENCE_DETECTION_STATIC_CONFIG
+ * @brief If defined, the chirps per frame are the constant of radar_settings.h (through radar_tables.h):
+ * the loops of this file are compiled with constant trip counts. Other lengths are rejected.
+ */
+#ifdef PRESENCE_DETECTION_STATIC_CONFIG
+#include "radar_tables.h"
+#define STATIC_LENGTH(length, constant)		do { if ((length) != (constant)) return IFX_SENSOR_DSP_ARGUMENT_ERROR; (length) = (constant); } while (0)
+#else
+#define STATIC_LENGTH(length, constant)		do { } while (0)
+#endif
+
+/**
+ * @brief Mean removal, windowing and FFT (in place) of the slow-time signal of a bin
+ */
+static inline void doppler_fft_process(cfloat32_t* doppler,
+		bool mean_removal,
+		const float32_t* win,
+		const arm_cfft_instance_f32* cfft,
+		uint16_t num_chirps_per_frame);
 
 int32_t doppler_fft_bin_do(cfloat32_t* range,
 		cfloat32_t* doppler,
 		bool mean_removal,
 		const float32_t* win,
+		const arm_cfft_instance_f32* cfft,
 		uint16_t bin_index,
 		uint16_t antenna_index,
 		uint16_t num_chirps_per_frame,
@@ -25,14 +48,13 @@ int32_t doppler_fft_bin_do(cfloat32_t* range,
 {
     if (range == NULL) return -1;
     if (doppler == NULL) return 2;
+    STATIC_LENGTH(num_chirps_per_frame, RADAR_TABLES_NUM_CHIRPS_PER_FRAME);
 
-    static arm_cfft_instance_f32 cfft = { 0 };
-    if (cfft.fftLen != num_chirps_per_frame)
+    // Get the FFT plan from the shared cache (only if no plan is given)
+    if (cfft == NULL)
     {
-        if (arm_cfft_init_f32(&cfft, num_chirps_per_frame) != ARM_MATH_SUCCESS)
-        {
-            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
-        }
+        cfft = fft_plan_cache_get_cfft_f32(num_chirps_per_frame);
+        if (cfft == NULL) return IFX_SENSOR_DSP_ARGUMENT_ERROR;
     }
 
     // Construct the source array -> computation of FFT in place
@@ -42,6 +64,39 @@ int32_t doppler_fft_bin_do(cfloat32_t* range,
     	doppler[chirp_idx] = range[start_index + chirp_idx * range_fft_len + bin_index];
     }
 
+    doppler_fft_process(doppler, mean_removal, win, cfft, num_chirps_per_frame);
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+int32_t doppler_fft_bin_do_cube(const range_cube_t* cube,
+		cfloat32_t* doppler,
+		bool mean_removal,
+		const float32_t* win,
+		const arm_cfft_instance_f32* cfft,
+		uint16_t bin_index,
+		uint16_t antenna_index,
+		uint16_t num_chirps_per_frame)
+{
+    if (cube == NULL) return -1;
+    if (doppler == NULL) return 2;
+    if (cfft == NULL) return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    STATIC_LENGTH(num_chirps_per_frame, RADAR_TABLES_NUM_CHIRPS_PER_FRAME);
+
+    // Construct the source array (expanded to float) -> computation of FFT in place
+    range_cube_gather_bin(cube, antenna_index * num_chirps_per_frame, num_chirps_per_frame, bin_index, doppler);
+
+    doppler_fft_process(doppler, mean_removal, win, cfft, num_chirps_per_frame);
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+static inline void doppler_fft_process(cfloat32_t* doppler,
+		bool mean_removal,
+		const float32_t* win,
+		const arm_cfft_instance_f32* cfft,
+		uint16_t num_chirps_per_frame)
+{
     // Mean removal
     if (mean_removal)
 	{
@@ -58,10 +113,75 @@ int32_t doppler_fft_bin_do(cfloat32_t* range,
 	}
 
     // Complex FFT
-    arm_cfft_f32(&cfft, (float32_t*)doppler, 0, 1);
+    arm_cfft_f32(cfft, (float32_t*)doppler, 0, 1);
+
+    // Remark: the 0 frequency is not centered, use doppler_fft_shift if needed
+}
 
-    // Remark: to be correct, we should shift the buffer, to center the 0 frequency
+int32_t doppler_fft_bin_do_q31(const q15_t* range,
+		q31_t* doppler,
+		bool mean_removal,
+		const q31_t* win,
+		const arm_cfft_instance_q31* cfft,
+		uint16_t bin_index,
+		uint16_t antenna_index,
+		uint16_t num_chirps_per_frame,
+		uint16_t range_fft_len)
+{
+    if (range == NULL) return -1;
+    if (doppler == NULL) return 2;
+    if (cfft == NULL) return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    STATIC_LENGTH(num_chirps_per_frame, RADAR_TABLES_NUM_CHIRPS_PER_FRAME);
+
+    // Construct the source array (with one guard bit) -> computation of FFT in place
+    const uint32_t start_index = (uint32_t)antenna_index * num_chirps_per_frame * range_fft_len;
+    int64_t sum_real = 0;
+    int64_t sum_imag = 0;
+    for (uint16_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+    {
+    	const q15_t* value = &range[2U * (start_index + chirp_idx * range_fft_len + bin_index)];
+    	doppler[2U * chirp_idx] = ((q31_t)value[0]) << 15;
+    	doppler[2U * chirp_idx + 1U] = ((q31_t)value[1]) << 15;
+    	sum_real += doppler[2U * chirp_idx];
+    	sum_imag += doppler[2U * chirp_idx + 1U];
+    }
+
+    // Mean removal
+    if (mean_removal)
+	{
+    	const q31_t mean_real = (q31_t)(sum_real / num_chirps_per_frame);
+    	const q31_t mean_imag = (q31_t)(sum_imag / num_chirps_per_frame);
+    	for (uint16_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+    	{
+    		doppler[2U * chirp_idx] -= mean_real;
+    		doppler[2U * chirp_idx + 1U] -= mean_imag;
+    	}
+	}
+
+    // Windowing (the window is not larger than 1 -> the guard bit is kept)
+    if (win != NULL)
+    {
+    	for (uint16_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+    	{
+    		doppler[2U * chirp_idx] = (q31_t)(((int64_t)doppler[2U * chirp_idx] * win[chirp_idx]) >> 31);
+    		doppler[2U * chirp_idx + 1U] = (q31_t)(((int64_t)doppler[2U * chirp_idx + 1U] * win[chirp_idx]) >> 31);
+    	}
+    }
+
+    // Complex FFT
+    arm_cfft_q31(cfft, doppler, 0, 1);
 
     return IFX_SENSOR_DSP_STATUS_OK;
 }
 
+void doppler_fft_shift(cfloat32_t* doppler, uint16_t num_chirps_per_frame)
+{
+	const uint16_t half = num_chirps_per_frame / 2;
+	for (uint16_t idx = 0; idx < half; ++idx)
+	{
+		cfloat32_t tmp = doppler[idx];
+		doppler[idx] = doppler[idx + half];
+		doppler[idx + half] = tmp;
+	}
+}
+
@@ -16,6 +16,7 @@
 #define PRESENCE_DETECTION_DOPPLER_FFT_H_
 
 #include "ifx_sensor_dsp.h"
+#include "range_cube.h"
 
 /**
  * @brief Compute the Doppler FFT for the given bin (bin_index)
@@ -32,6 +33,7 @@
  *
  * @param [in] mean_removal	Perform mean removal or not before computing FFT
  * @param [in] win	Window to be applied to the signal before computing FFT
+ * @param [in] cfft	Complex FFT plan (num_chirps_per_frame points). If NULL, the plan is taken from the plan cache
  * @param [in] bin_index	Index of the bin for which the doppler FFT has to be computed [0] to [(num_samples_per_chirp / 2) - 1]
  * @param [in] antenna_index	Index of the antenna for which the doppler FFT has to be computed
  * @param [in] num_chirps_per_frame	Number of chirps per frame
@@ -43,9 +45,70 @@ int32_t doppler_fft_bin_do(cfloat32_t* range,
 		cfloat32_t* doppler,
 		bool mean_removal,
 		const float32_t* win,
+		const arm_cfft_instance_f32* cfft,
 		uint16_t bin_index,
 		uint16_t antenna_index,
 		uint16_t num_chirps_per_frame,
 		uint16_t range_fft_len);
 
+/**
+ * @brief Version of doppler_fft_bin_do reading a range cube (the packed values are expanded during the gather)
+ *
+ * @param [in] cube	Range cube (chirps of antenna a start at a * num_chirps_per_frame)
+ * @param [in] cfft	Complex FFT plan (num_chirps_per_frame points)
+ *
+ * Other parameters: same as doppler_fft_bin_do
+ *
+ * @retval 0 On success
+ */
+int32_t doppler_fft_bin_do_cube(const range_cube_t* cube,
+		cfloat32_t* doppler,
+		bool mean_removal,
+		const float32_t* win,
+		const arm_cfft_instance_f32* cfft,
+		uint16_t bin_index,
+		uint16_t antenna_index,
+		uint16_t num_chirps_per_frame);
+
+/**
+ * @brief Fixed-point version of doppler_fft_bin_do (Q31)
+ *
+ * Scaling at each stage:
+ * - Range value (Q15) << 15 -> Q31 divided by 2 (one guard bit for the mean removal)
+ * - Mean removal -> |x| < 1
+ * - arm_cfft_q31 scales its output down by num_chirps_per_frame (CMSIS: 5.27 format for 16 points)
+ *   -> doppler_q31 = doppler(range_q15) / (2 * num_chirps_per_frame)
+ *
+ * @param [in] range	Output of range_fft_do_q15
+ * @param [out] doppler	Doppler FFT for the given bin (interleaved real, imaginary)
+ * 						Size of this buffer is num_chirps_per_frame * 2 * sizeof(q31_t)
+ * @param [in] mean_removal	Perform mean removal or not before computing FFT
+ * @param [in] win	Q31 window applied after the mean removal (NULL -> no window)
+ * @param [in] cfft	Q31 complex FFT plan (num_chirps_per_frame points)
+ * @param [in] bin_index	Index of the bin for which the doppler FFT has to be computed
+ * @param [in] antenna_index	Index of the antenna for which the doppler FFT has to be computed
+ * @param [in] num_chirps_per_frame	Number of chirps per frame
+ * @param [in] range_fft_len	Length of the computed range FFT (per chirp)
+ *
+ * @retval 0 On success
+ */
+int32_t doppler_fft_bin_do_q31(const q15_t* range,
+		q31_t* doppler,
+		bool mean_removal,
+		const q31_t* win,
+		const arm_cfft_instance_q31* cfft,
+		uint16_t bin_index,
+		uint16_t antenna_index,
+		uint16_t num_chirps_per_frame,
+		uint16_t range_fft_len);
+
+/**
+ * @brief Swap the two halves of the Doppler FFT (fftshift) to center the 0 frequency
+ * After the shift, index num_chirps_per_frame / 2 corresponds to 0 m/s
+ *
+ * @param [inout] doppler	Output of doppler_fft_bin_do
+ * @param [in] num_chirps_per_frame	Number of chirps per frame (even)
+ */
+void doppler_fft_shift(cfloat32_t* doppler, uint16_t num_chirps_per_frame);
+
 #endif /* PRESENCE_DETECTION_DOPPLER_FFT_H_ */
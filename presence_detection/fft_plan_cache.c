@@ -0,0 +1,106 @@
+/*
+ * fft_plan_cache.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+
+#include "fft_plan_cache.h"
+#include "radar_tables.h"
+
+typedef struct
+{
+	fft_plan_type_t type;
+	uint16_t length;		/**< 0 -> free entry */
+	union
+	{
+		arm_rfft_fast_instance_f32 rfft_f32;
+		arm_cfft_instance_f32 cfft_f32;
+		arm_rfft_instance_q15 rfft_q15;
+		arm_cfft_instance_q31 cfft_q31;
+	} plan;
+} fft_plan_cache_entry_t;
+
+static fft_plan_cache_entry_t cache[FFT_PLAN_CACHE_SIZE];
+
+/**
+ * @brief Find the plan of a (type, length) pair, initialize it in a free entry if not found
+ */
+static fft_plan_cache_entry_t* get_entry(fft_plan_type_t type, uint16_t length)
+{
+	if (length == 0) return NULL;
+
+	fft_plan_cache_entry_t* free_entry = NULL;
+	for(uint8_t i = 0; i < FFT_PLAN_CACHE_SIZE; ++i)
+	{
+		if ((cache[i].length == length) && (cache[i].type == type)) return &cache[i];
+		if ((cache[i].length == 0) && (free_entry == NULL)) free_entry = &cache[i];
+	}
+	if (free_entry == NULL) return NULL;
+
+	arm_status status = ARM_MATH_ARGUMENT_ERROR;
+	switch(type)
+	{
+		case FFT_PLAN_RFFT_F32:
+			status = arm_rfft_fast_init_f32(&free_entry->plan.rfft_f32, length);
+			break;
+		case FFT_PLAN_CFFT_F32:
+			status = arm_cfft_init_f32(&free_entry->plan.cfft_f32, length);
+			break;
+		case FFT_PLAN_RFFT_Q15:
+			status = arm_rfft_init_q15(&free_entry->plan.rfft_q15, length, 0, 1);
+			break;
+		case FFT_PLAN_CFFT_Q31:
+			status = arm_cfft_init_q31(&free_entry->plan.cfft_q31, length);
+			break;
+	}
+	if (status != ARM_MATH_SUCCESS) return NULL;
+
+	free_entry->type = type;
+	free_entry->length = length;
+	return free_entry;
+}
+
+const arm_rfft_fast_instance_f32* fft_plan_cache_get_rfft_f32(uint16_t length)
+{
+	if (length == RADAR_TABLES_NUM_SAMPLES_PER_CHIRP) return &radar_tables_range_rfft;
+
+	fft_plan_cache_entry_t* entry = get_entry(FFT_PLAN_RFFT_F32, length);
+	return (entry != NULL) ? &entry->plan.rfft_f32 : NULL;
+}
+
+const arm_cfft_instance_f32* fft_plan_cache_get_cfft_f32(uint16_t length)
+{
+	if (length == RADAR_TABLES_NUM_CHIRPS_PER_FRAME) return radar_tables_doppler_cfft;
+
+	fft_plan_cache_entry_t* entry = get_entry(FFT_PLAN_CFFT_F32, length);
+	return (entry != NULL) ? &entry->plan.cfft_f32 : NULL;
+}
+
+const arm_rfft_instance_q15* fft_plan_cache_get_rfft_q15(uint16_t length)
+{
+	fft_plan_cache_entry_t* entry = get_entry(FFT_PLAN_RFFT_Q15, length);
+	return (entry != NULL) ? &entry->plan.rfft_q15 : NULL;
+}
+
+const arm_cfft_instance_q31* fft_plan_cache_get_cfft_q31(uint16_t length)
+{
+	fft_plan_cache_entry_t* entry = get_entry(FFT_PLAN_CFFT_Q31, length);
+	return (entry != NULL) ? &entry->plan.cfft_q31 : NULL;
+}
+
+void fft_plan_cache_clear()
+{
+	for(uint8_t i = 0; i < FFT_PLAN_CACHE_SIZE; ++i)
+	{
+		cache[i].length = 0;
+	}
+}
@@ -0,0 +1,55 @@
+/*
+ * fft_plan_cache.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef PRESENCE_DETECTION_FFT_PLAN_CACHE_H_
+#define PRESENCE_DETECTION_FFT_PLAN_CACHE_H_
+
+#include "ifx_sensor_dsp.h"
+
+/**
+ * @def FFT_PLAN_CACHE_SIZE
+ * @brief Maximum number of plans initialized at runtime (the plans of radar_tables.h do not use an entry)
+ */
+#ifndef FFT_PLAN_CACHE_SIZE
+#define FFT_PLAN_CACHE_SIZE		6
+#endif
+
+typedef enum
+{
+	FFT_PLAN_RFFT_F32 = 0,	/**< arm_rfft_fast_instance_f32 */
+	FFT_PLAN_CFFT_F32,		/**< arm_cfft_instance_f32 */
+	FFT_PLAN_RFFT_Q15,		/**< arm_rfft_instance_q15 (forward, bit reversal) */
+	FFT_PLAN_CFFT_Q31,		/**< arm_cfft_instance_q31 */
+} fft_plan_type_t;
+
+/**
+ * @brief Get a plan, shared by all the pipeline stages
+ * The plan is initialized on the first request of a (type, length) pair, the next requests only look it up
+ * (presence_detection_init requests its plans, they are ready before the first frame)
+ * The constant plans generated from radar_settings.h are returned if the length matches
+ *
+ * @retval NULL if the length is not supported or the cache is full
+ */
+const arm_rfft_fast_instance_f32* fft_plan_cache_get_rfft_f32(uint16_t length);
+const arm_cfft_instance_f32* fft_plan_cache_get_cfft_f32(uint16_t length);
+const arm_rfft_instance_q15* fft_plan_cache_get_rfft_q15(uint16_t length);
+const arm_cfft_instance_q31* fft_plan_cache_get_cfft_q31(uint16_t length);
+
+/**
+ * @brief Release all the plans initialized at runtime
+ * The pointers returned before must not be used anymore
+ */
+void fft_plan_cache_clear();
+
+#endif /* PRESENCE_DETECTION_FFT_PLAN_CACHE_H_ */
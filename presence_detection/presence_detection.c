@@ -16,6 +16,9 @@
 #include "presence_detection_internal.h"
 #include "range_fft.h"
 #include "doppler_fft.h"
+#include "radar_tables.h"
+#include "fft_plan_cache.h"
+#include "window.h"
 
 /**
  * @def DEBUG_AMPLITUDE
@@ -29,10 +32,85 @@
  */
 #undef DEBUG_PHASE_CONTENT
 
+#include <math.h>
+#include <string.h>
+
 #if defined(DEBUG_AMPLITUDE) || defined(DEBUG_PHASE_CONTENT)
 #include <stdio.h>
 #endif
 
+/**
+ * Doppler peak of a bin, kept from the Doppler pass of the frame for the interpolation of the zone peaks
+ */
+typedef struct
+{
+	uint16_t index;		/**< Index of the maximum inside the (not shifted) Doppler spectrum */
+	float left;			/**< Magnitude of the neighbors of the maximum (circular) */
+	float right;
+} doppler_peak_t;
+
+/**
+ * @def PRESENCE_DETECTION_STATIC_CONFIG
+ * @brief If defined (e.g. DEFINES+=PRESENCE_DETECTION_STATIC_CONFIG inside the Makefile), the buffer sizes,
+ * loop trip counts and FFT lengths are compile-time constants taken from radar_settings.h (through radar_tables.h)
+ * and all the buffers are statically allocated (visible inside the linker map). presence_detection_init then
+ * only accepts the configuration of radar_settings.h.
+ * If not defined, everything is sized at runtime from radar_configuration_t and allocated with internal_malloc.
+ */
+#ifdef PRESENCE_DETECTION_STATIC_CONFIG
+
+/**
+ * @def PRESENCE_DETECTION_STATIC_SLOW_TIME_HISTORY
+ * @brief Maximum slow_time_history accepted in static configuration
+ */
+#ifndef PRESENCE_DETECTION_STATIC_SLOW_TIME_HISTORY
+#define PRESENCE_DETECTION_STATIC_SLOW_TIME_HISTORY		1
+#endif
+
+/**
+ * @def PRESENCE_DETECTION_STATIC_RANGE_CUBE_FORMAT
+ * @brief Storage format of the range cube in static configuration (params.range_cube_format must be the same or more compact)
+ */
+#ifndef PRESENCE_DETECTION_STATIC_RANGE_CUBE_FORMAT
+#define PRESENCE_DETECTION_STATIC_RANGE_CUBE_FORMAT		RANGE_CUBE_FORMAT_FLOAT32
+#endif
+
+#define SAMPLES_PER_CHIRP		(RADAR_TABLES_NUM_SAMPLES_PER_CHIRP)
+#define CHIRPS_PER_FRAME		(RADAR_TABLES_NUM_CHIRPS_PER_FRAME)
+#define RANGE_FFT_LEN			(RADAR_TABLES_NUM_SAMPLES_PER_CHIRP / 2)
+
+// Also used as Q15 scratch (input and output of the real FFT: 3 * SAMPLES_PER_CHIRP q15) by the fixed-point pipeline
+static float adc_samples_storage[(3 * SAMPLES_PER_CHIRP) / 2];
+// The Q15 range cube of the fixed-point pipeline (4 bytes per value) fits in every format
+static cfloat32_t range_storage[(RANGE_CUBE_STORAGE_SIZE(PRESENCE_DETECTION_STATIC_RANGE_CUBE_FORMAT, RADAR_TABLES_NUM_RX_ANTENNAS * CHIRPS_PER_FRAME, RANGE_FFT_LEN) + sizeof(cfloat32_t) - 1) / sizeof(cfloat32_t)];
+static cfloat32_t range_spectrum_storage[RANGE_FFT_LEN];
+static cfloat32_t doppler_out_storage[CHIRPS_PER_FRAME];
+static q31_t doppler_window_q31_storage[CHIRPS_PER_FRAME];
+static float bin_magnitude_storage[RANGE_FFT_LEN];
+static doppler_peak_t bin_peak_storage[RANGE_FFT_LEN];
+static cfloat32_t slow_time_storage[RANGE_FFT_LEN * PRESENCE_DETECTION_STATIC_SLOW_TIME_HISTORY];
+
+#define STATIC_STORAGE(buffer)	buffer, sizeof(buffer)
+
+#else
+
+#define SAMPLES_PER_CHIRP		(internal_params.samples_per_chirp)
+#define CHIRPS_PER_FRAME		(internal_params.chirps_per_frame)
+#define RANGE_FFT_LEN			(internal_params.range_fft_len)
+#endif
+
+/**
+ * @def ROI_BIN_COUNT
+ * @brief Number of bins stored per chirp inside the range cube (union of all zones)
+ */
+#define ROI_BIN_COUNT			(internal_params.bin_end - internal_params.bin_start)
+
+#ifndef PRESENCE_DETECTION_STATIC_CONFIG
+
+#define STATIC_STORAGE(buffer)	NULL, 0
+
+#endif
+
 /**
  * @var internal_malloc
  * Function enabling to allocate memory
@@ -46,7 +124,48 @@ static free_func_t internal_free = NULL;
  */
 static presence_detection_listener_func_t internal_listener = NULL;
 
-static const uint8_t REQUIRED_ANTENNA_COUNT = 1;
+/**
+ * @def ANTENNA_COUNT
+ * @brief Number of antennas inside the frames (the range FFT is computed for each antenna, the detection uses antenna 0)
+ */
+#define ANTENNA_COUNT			(internal_params.antenna_count)
+
+/**
+ * Buffers of the algorithm. Runtime configuration: kept from one initialization to the next one
+ * and only reallocated if they are too small (the detector can be reinitialized in place)
+ */
+typedef enum
+{
+	ALLOCATION_ADC_SAMPLES = 0,
+	ALLOCATION_RANGE,
+	ALLOCATION_RANGE_SPECTRUM,
+	ALLOCATION_RANGE_ZOOM,
+	ALLOCATION_DOPPLER_OUT,
+	ALLOCATION_RANGE_WINDOW,
+	ALLOCATION_DOPPLER_WINDOW,
+	ALLOCATION_RANGE_WINDOW_Q15,
+	ALLOCATION_DOPPLER_WINDOW_Q31,
+	ALLOCATION_BIN_MAGNITUDE,
+	ALLOCATION_BIN_PEAK,
+	ALLOCATION_SLOW_TIME,
+	ALLOCATION_COUNT,
+} allocation_t;
+
+#ifndef PRESENCE_DETECTION_STATIC_CONFIG
+static void* allocations[ALLOCATION_COUNT];
+static size_t allocation_sizes[ALLOCATION_COUNT];
+#endif
+
+/**
+ * @var init_params
+ * Parameters of the last initialization (reused by presence_detection_set_radar_configuration)
+ * The zone table is copied
+ * init_params_valid -> parameters kept, initialized -> last configuration succeeded (data can be fed)
+ */
+static presence_detection_param_t init_params;
+static presence_detection_zone_t init_zones[PRESENCE_DETECTION_MAX_ZONES];
+static bool init_params_valid = false;
+static bool initialized = false;
 
 /**
  * @var adc_samples
@@ -58,18 +177,79 @@ static float* adc_samples = NULL;
 /**
  * @var window
  * Window used to be applied on the time signal before computing real FFT
+ * Includes the ADC scaling (1/4096)
+ * Points to the constant table (flash) if the configuration matches radar_settings.h
  */
-static float* window = NULL;
+static const float* window = NULL;
+
+/**
+ * @var use_radar_tables
+ * True if the radar configuration matches the tables generated from radar_settings.h
+ */
+static bool use_radar_tables = false;
+
+/**
+ * @var doppler_window
+ * Window applied before the Doppler FFT, normalized by its coherent gain (NULL -> no window)
+ */
+static const float* doppler_window = NULL;
+
+/**
+ * @var range_rfft, doppler_cfft
+ * FFT plans taken from the plan cache during init (ready before the first frame)
+ */
+static const arm_rfft_fast_instance_f32* range_rfft = NULL;
+static const arm_cfft_instance_f32* doppler_cfft = NULL;
+
+/**
+ * @var range_rfft_q15, doppler_cfft_q31, window_q15
+ * Fixed-point pipeline (PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT)
+ * The Q15 range cube uses the memory of range, the Q31 Doppler spectrum uses the memory of doppler_out
+ * and the Q15 scratch of the range FFT uses the memory of adc_samples
+ */
+static const arm_rfft_instance_q15* range_rfft_q15 = NULL;
+static const arm_cfft_instance_q31* doppler_cfft_q31 = NULL;
+static const q15_t* window_q15 = NULL;
+static const q31_t* doppler_window_q31 = NULL;
+
+/**
+ * @var range_zoom
+ * Zoom DFT computing only the bins of interest on the fine grid (params.range_zoom > 1)
+ */
+static range_zoom_t range_zoom;
+static bool range_zoom_enabled = false;
+
+/**
+ * @var fixed_point_range_scale, fixed_point_doppler_scale
+ * Conversion of the fixed-point values to the scale of the float pipeline
+ * - range: arm_rfft_q15 divides by (samples per chirp / 2), value = q15 / 2^15 * (samples per chirp / 2)
+ * - Doppler: one guard bit and arm_cfft_q31 divides by chirps per frame, value = q31 / 2^31 * (samples per chirp / 2) * 2 * chirps per frame
+ *   (arm_cmplx_mag_q31 output is 2.30 -> magnitude = mag / 2^30 * (samples per chirp / 2) * 2 * chirps per frame)
+ */
+static float fixed_point_range_scale = 0;
+static float fixed_point_doppler_scale = 0;
 
 /**
  * @var range
- * Store the output of the range computation
+ * Store the output of the range computation, only for the bins between bin_start and bin_end (region of interest)
  * Allocated once at start
- * Size is antenna count * chirps per frame * (samples per chirp / 2) * sizeof(cfloat)
- * Why samples per chirp / 2 and not (samples per chirp) / 2 + 1 -> because of the implementation of the FFT
+ * Size is antenna count * chirps per frame * (bin_end - bin_start) * size of a value (see range_cube_format_t, Q15 for the fixed-point pipeline)
  */
 static cfloat32_t* range = NULL;
 
+/**
+ * @var range_cube
+ * Float pipeline: description of the range storage (float, half precision or block floating point)
+ */
+static range_cube_t range_cube;
+
+/**
+ * @var range_spectrum
+ * Complete range FFT of one chirp before copy of the region of interest and packing
+ * (not needed if the range cube is float and covers all the bins)
+ */
+static cfloat32_t* range_spectrum = NULL;
+
 /**
  * @var doppler_out
  * Store the result of the doppler FFT for one bin
@@ -77,12 +257,108 @@ static cfloat32_t* range = NULL;
  */
 static cfloat32_t* doppler_out = NULL;
 
+/**
+ * @var slow_time
+ * Store one sample per frame for each bin between bin_start and bin_end
+ * Storage size is (bin_end - bin_start) * slow_time_history * sizeof(cfloat)
+ */
+static slow_time_buffer_t slow_time;
+static bool slow_time_enabled = false;
+
+/**
+ * @var vital_signs
+ * Respiration estimation based on the phase of the maximum bin
+ */
+static vital_signs_t vital_signs;
+
+/**
+ * @var bin_magnitude
+ * Maximum magnitude of the Doppler FFT of each bin between bin_start and bin_end
+ * Computed once per frame and shared by all zones
+ */
+static float* bin_magnitude = NULL;
+
+/**
+ * @var bin_peak
+ * Position and neighbors of the maximum of the Doppler FFT of each bin between bin_start and bin_end
+ * Computed with bin_magnitude: the zone peaks are interpolated without a second Doppler FFT
+ */
+static doppler_peak_t* bin_peak = NULL;
+
+/**
+ * @var zones
+ * Bin range and state (hysteresis, confirmation and hold time) of each zone
+ */
+static presence_detection_internal_zone_t zones[PRESENCE_DETECTION_MAX_ZONES];
+
 /**
  * @var internal_params
  * Internal parameters used for the presence detection algorithm
  */
 static presence_detection_internal_param_t internal_params;
 
+/**
+ * @var next_chirp
+ * Index of the next chirp expected by presence_detection_feed_chirps (0 -> start of a frame)
+ */
+static uint16_t next_chirp = 0;
+
+
+/**
+ * @brief Get the memory of a buffer
+ * Static configuration: the static storage is returned if it is big enough
+ * Runtime configuration: the buffer of the previous initialization is reused if it is big enough,
+ * else the memory is allocated using internal_malloc
+ */
+static void* allocate(allocation_t allocation, void* storage, size_t storage_size, size_t size)
+{
+#ifdef PRESENCE_DETECTION_STATIC_CONFIG
+	(void) allocation;
+	(void) internal_malloc;
+	return (size <= storage_size) ? storage : NULL;
+#else
+	(void) storage;
+	(void) storage_size;
+
+	if ((allocations[allocation] != NULL) && (size <= allocation_sizes[allocation]))
+	{
+		return allocations[allocation];
+	}
+
+	if (allocations[allocation] != NULL)
+	{
+		internal_free(allocations[allocation]);
+	}
+	allocations[allocation] = internal_malloc(size);
+	allocation_sizes[allocation] = (allocations[allocation] != NULL) ? size : 0;
+	return allocations[allocation];
+#endif
+}
+
+/**
+ * @brief Convert a (normalized) float window to fixed point with a peak of 1
+ *
+ * @param [out] q15	Q15 window (can be NULL)
+ * @param [out] q31	Q31 window (can be NULL)
+ *
+ * @retval Peak of the float window (float window = peak * fixed-point window)
+ */
+static float window_to_fixed_point(const float* win, uint16_t len, q15_t* q15, q31_t* q31)
+{
+	float peak = 0;
+	for(uint16_t i = 0; i < len; ++i)
+	{
+		if (win[i] > peak) peak = win[i];
+	}
+
+	for(uint16_t i = 0; i < len; ++i)
+	{
+		const float value = win[i] / peak;
+		if (q15 != NULL) q15[i] = (value >= 1.f) ? 32767 : (q15_t) roundf(value * 32768.f);
+		if (q31 != NULL) q31[i] = (value >= 1.f) ? 0x7FFFFFFF : (q31_t) (value * 2147483648.f);
+	}
+	return peak;
+}
 
 void presence_detection_set_malloc_free(malloc_func_t malloc, free_func_t free)
 {
@@ -95,11 +371,16 @@ void presence_detection_set_listener(presence_detection_listener_func_t listener
 	internal_listener = listener;
 }
 
-int presence_detection_init(radar_configuration_t radar_configuration, presence_detection_param_t params)
+/**
+ * @brief Configure the algorithm (buffers, windows, zones) for a radar configuration
+ */
+static int configure(radar_configuration_t radar_configuration, presence_detection_param_t params)
 {
-	if (radar_configuration.antenna_count != REQUIRED_ANTENNA_COUNT) return -1;
+	if (radar_configuration.antenna_count == 0) return -1;
+#ifndef PRESENCE_DETECTION_STATIC_CONFIG
 	if (internal_free == NULL) return -2;
 	if (internal_malloc == NULL) return -3;
+#endif
 
 	// Save
 	internal_params.antenna_count = radar_configuration.antenna_count;
@@ -108,41 +389,336 @@ int presence_detection_init(radar_configuration_t radar_configuration, presence_
 	internal_params.sampling_rate = radar_configuration.sampling_rate;
 	internal_params.start_freq = radar_configuration.start_freq;
 	internal_params.end_freq = radar_configuration.end_freq;
+	internal_params.chirp_repetition_time = radar_configuration.chirp_repetition_time;
+	internal_params.frame_repetition_time = radar_configuration.frame_repetition_time;
+	next_chirp = 0;
+
+	use_radar_tables = (radar_configuration.samples_per_chirp == RADAR_TABLES_NUM_SAMPLES_PER_CHIRP)
+			&& (radar_configuration.chirps_per_frame == RADAR_TABLES_NUM_CHIRPS_PER_FRAME)
+			&& (radar_configuration.sampling_rate == RADAR_TABLES_SAMPLE_RATE)
+			&& (radar_configuration.start_freq == RADAR_TABLES_START_FREQ_HZ)
+			&& (radar_configuration.end_freq == RADAR_TABLES_END_FREQ_HZ);
+#ifdef PRESENCE_DETECTION_STATIC_CONFIG
+	if (!use_radar_tables) return -18;
+	if (radar_configuration.antenna_count != RADAR_TABLES_NUM_RX_ANTENNAS) return -18;
+#endif
 
 	internal_params.threshold = params.threshold;
+	internal_params.threshold_exit = params.threshold_exit;
+	internal_params.confirm_frames = params.confirm_frames;
+	internal_params.hold_frames = params.hold_frames;
+	internal_params.slow_time_history = params.slow_time_history;
+	internal_params.vital_signs = params.vital_signs;
+	internal_params.arithmetic = params.arithmetic;
+	internal_params.range_cube_format = params.range_cube_format;
+	internal_params.range_window = params.range_window;
+	internal_params.doppler_window = params.doppler_window;
+
+	// Range grid: native FFT, zoom DFT with range_zoom points per native bin or zero-padded FFT
+	const uint8_t zoom = (params.range_zoom > 1) ? params.range_zoom : 1;
+	const uint8_t padding = (params.range_fft_padding > 1) ? params.range_fft_padding : 1;
+	if ((zoom != 1) && (padding != 1)) return -20;
+	const uint8_t oversampling = zoom * padding;
+	internal_params.range_fft_len = (radar_configuration.samples_per_chirp / 2) * oversampling;
+#ifdef PRESENCE_DETECTION_STATIC_CONFIG
+	if (oversampling != 1) return -20;
+#endif
+	if ((oversampling != 1) && (internal_params.arithmetic == PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT)) return -20;
 
-	// Compute bin_start and bin_end
-	if (params.bin_start == params.bin_end)
+	presence_state_param_t state_params;
+	state_params.confirm_frames = internal_params.confirm_frames;
+	state_params.hold_frames = internal_params.hold_frames;
+
+	if (params.zone_count == 0)
 	{
-		// Total range
-		const uint16_t fft_len = internal_params.samples_per_chirp / 2;
-		internal_params.bin_start = 0;
-		internal_params.bin_end = fft_len;
+		if (internal_params.threshold_exit > internal_params.threshold) return -13;
+
+		// Compute bin_start and bin_end
+		if (params.bin_start == params.bin_end)
+		{
+			// Total range
+			internal_params.bin_start = 0;
+			internal_params.bin_end = internal_params.range_fft_len;
+		}
+		else if (params.bin_start > params.bin_end)
+		{
+			return -4;
+		}
+		else
+		{
+			// Bins of the native FFT -> range grid
+			internal_params.bin_start = params.bin_start * oversampling;
+			internal_params.bin_end = params.bin_end * oversampling;
+			if (internal_params.bin_end > internal_params.range_fft_len) return -4;
+		}
+
+		internal_params.zone_count = 1;
+		zones[0].bin_start = internal_params.bin_start;
+		zones[0].bin_end = internal_params.bin_end;
+		state_params.threshold_enter = internal_params.threshold;
+		state_params.threshold_exit = internal_params.threshold_exit;
+		presence_state_init(&zones[0].state, state_params);
 	}
-	else if (params.bin_start > params.bin_end)
+	else
 	{
-		return -4;
+		// Convert the zones from meters to bins, the processing window is the union of all zones
+		const uint16_t fft_len = internal_params.range_fft_len;
+		const float meters_per_bin = presence_detection_bin_to_meters(1);
+		internal_params.bin_start = fft_len;
+		internal_params.bin_end = 0;
+		internal_params.zone_count = params.zone_count;
+		for(uint8_t zone_idx = 0; zone_idx < params.zone_count; ++zone_idx)
+		{
+			const presence_detection_zone_t* zone = &params.zones[zone_idx];
+			if ((zone->start < 0) || (zone->end <= zone->start)) return -15;
+			if (zone->threshold_exit > zone->threshold) return -13;
+
+			float bin_start = floorf(zone->start / meters_per_bin);
+			float bin_end = ceilf(zone->end / meters_per_bin) + 1;
+			if (bin_start >= fft_len) return -15;
+			if (bin_end > fft_len) bin_end = fft_len;
+
+			zones[zone_idx].bin_start = (uint16_t) bin_start;
+			zones[zone_idx].bin_end = (uint16_t) bin_end;
+			if (zones[zone_idx].bin_start < internal_params.bin_start) internal_params.bin_start = zones[zone_idx].bin_start;
+			if (zones[zone_idx].bin_end > internal_params.bin_end) internal_params.bin_end = zones[zone_idx].bin_end;
+
+			state_params.threshold_enter = zone->threshold;
+			state_params.threshold_exit = zone->threshold_exit;
+			presence_state_init(&zones[zone_idx].state, state_params);
+		}
 	}
-	else
+
+	for(uint8_t zone_idx = 0; zone_idx < internal_params.zone_count; ++zone_idx)
 	{
-		internal_params.bin_start = params.bin_start;
-		internal_params.bin_end = params.bin_end;
+		memset(&zones[zone_idx].result, 0, sizeof(presence_detection_result_t));
 	}
 
 	// Allocate
-	adc_samples = (float*) internal_malloc(radar_configuration.samples_per_chirp * sizeof(float));
+	const bool fixed_point = (internal_params.arithmetic == PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT);
+	// Float: time buffer of the (zero-padded) range FFT
+	const size_t adc_samples_size = fixed_point ? (3 * radar_configuration.samples_per_chirp * sizeof(q15_t)) : (radar_configuration.samples_per_chirp * padding * sizeof(float));
+	adc_samples = (float*) allocate(ALLOCATION_ADC_SAMPLES, STATIC_STORAGE(adc_samples_storage), adc_samples_size);
 	if (adc_samples == NULL) return -5;
 
-	range = (cfloat32_t*) internal_malloc(radar_configuration.antenna_count * radar_configuration.chirps_per_frame * (radar_configuration.samples_per_chirp / 2) * sizeof(cfloat32_t));
+	// The fixed-point pipeline has its own (Q15) format
+	if (fixed_point && (internal_params.range_cube_format != RANGE_CUBE_FORMAT_FLOAT32)) return -19;
+
+	const uint16_t cube_chirp_count = radar_configuration.antenna_count * radar_configuration.chirps_per_frame;
+	const uint16_t cube_bin_count = ROI_BIN_COUNT;
+	const size_t range_size = fixed_point ? ((size_t) cube_chirp_count * cube_bin_count * 2 * sizeof(q15_t))
+			: range_cube_get_storage_size(internal_params.range_cube_format, cube_chirp_count, cube_bin_count);
+	range = (cfloat32_t*) allocate(ALLOCATION_RANGE, STATIC_STORAGE(range_storage), range_size);
 	if (range == NULL) return -6;
 
-	doppler_out = (cfloat32_t*) internal_malloc(radar_configuration.chirps_per_frame * sizeof(cfloat32_t));
-	if (range == NULL) return -7;
+	if (!fixed_point)
+	{
+		if (range_cube_init(&range_cube, internal_params.range_cube_format, range, cube_chirp_count, internal_params.bin_start, cube_bin_count) != 0) return -19;
+
+		range_spectrum = NULL;
+		if ((zoom != 1) && (internal_params.range_cube_format != RANGE_CUBE_FORMAT_FLOAT32))
+		{
+			// The zoom DFT only computes the bins of interest
+			range_spectrum = (cfloat32_t*) allocate(ALLOCATION_RANGE_SPECTRUM, STATIC_STORAGE(range_spectrum_storage), cube_bin_count * sizeof(cfloat32_t));
+			if (range_spectrum == NULL) return -6;
+		}
+		else if ((internal_params.range_cube_format != RANGE_CUBE_FORMAT_FLOAT32) || (cube_bin_count != internal_params.range_fft_len))
+		{
+			// Complete (padded) spectrum, the region of interest is copied out
+			range_spectrum = (cfloat32_t*) allocate(ALLOCATION_RANGE_SPECTRUM, STATIC_STORAGE(range_spectrum_storage), internal_params.range_fft_len * sizeof(cfloat32_t));
+			if (range_spectrum == NULL) return -6;
+		}
+	}
+
+	range_zoom_enabled = false;
+#ifndef PRESENCE_DETECTION_STATIC_CONFIG
+	if (zoom != 1)
+	{
+		// Frequencies of the bins of interest (in native bins)
+		void* zoom_storage = allocate(ALLOCATION_RANGE_ZOOM, NULL, 0, range_zoom_get_storage_size(cube_bin_count));
+		if (zoom_storage == NULL) return -20;
+		const float step = 1.f / (float) zoom;
+		if (range_zoom_init(&range_zoom, zoom_storage, radar_configuration.samples_per_chirp, (float) internal_params.bin_start * step, step, cube_bin_count) != 0) return -20;
+		range_zoom_enabled = true;
+	}
+#endif
+
+	doppler_out = (cfloat32_t*) allocate(ALLOCATION_DOPPLER_OUT, STATIC_STORAGE(doppler_out_storage), radar_configuration.chirps_per_frame * sizeof(cfloat32_t));
+	if (doppler_out == NULL) return -7;
+
+	// Windows normalized by their coherent gain -> the magnitudes (and thresholds) do not depend on the windows
+	if ((internal_params.range_window >= WINDOW_TYPE_COUNT) || (internal_params.doppler_window >= WINDOW_TYPE_COUNT)) return -8;
+	if (use_radar_tables)
+	{
+		// Windows are constant (generated from radar_settings.h)
+		window = radar_tables_range_window[internal_params.range_window];
+		doppler_window = (internal_params.doppler_window == WINDOW_NONE) ? NULL : radar_tables_doppler_window[internal_params.doppler_window];
+	}
+#ifndef PRESENCE_DETECTION_STATIC_CONFIG
+	else
+	{
+		// Generate windows
+		float* runtime_window = (float*) allocate(ALLOCATION_RANGE_WINDOW, NULL, 0, radar_configuration.samples_per_chirp * sizeof(float));
+		if (runtime_window == NULL) return -8;
+		window_generate_normalized(internal_params.range_window, runtime_window, radar_configuration.samples_per_chirp, 1.f / 4096.f);
+		window = runtime_window;
+
+		doppler_window = NULL;
+		if (internal_params.doppler_window != WINDOW_NONE)
+		{
+			float* runtime_doppler_window = (float*) allocate(ALLOCATION_DOPPLER_WINDOW, NULL, 0, radar_configuration.chirps_per_frame * sizeof(float));
+			if (runtime_doppler_window == NULL) return -8;
+			window_generate_normalized(internal_params.doppler_window, runtime_doppler_window, radar_configuration.chirps_per_frame, 1.f);
+			doppler_window = runtime_doppler_window;
+		}
+	}
+#endif
+
+	// Prewarm the FFT plans now (and not during the first frame). The constant plans generated from
+	// radar_settings.h are used if the lengths match. Zero-padded range FFT: samples per chirp * padding points
+	range_rfft = fft_plan_cache_get_rfft_f32(radar_configuration.samples_per_chirp * padding);
+	doppler_cfft = fft_plan_cache_get_cfft_f32(radar_configuration.chirps_per_frame);
+	if ((range_rfft == NULL) || (doppler_cfft == NULL)) return -17;
+
+	if (fixed_point)
+	{
+		// The fixed-point windows cannot hold the normalization (values > 1): they are scaled to a peak of 1
+		// and the coherent gains are folded inside the conversion to the float scale
+		if (use_radar_tables)
+		{
+			window_q15 = radar_tables_range_window_q15[internal_params.range_window];
+		}
+#ifndef PRESENCE_DETECTION_STATIC_CONFIG
+		else
+		{
+			q15_t* runtime_window_q15 = (q15_t*) allocate(ALLOCATION_RANGE_WINDOW_Q15, NULL, 0, radar_configuration.samples_per_chirp * sizeof(q15_t));
+			if (runtime_window_q15 == NULL) return -8;
+			window_to_fixed_point(window, radar_configuration.samples_per_chirp, runtime_window_q15, NULL);
+			window_q15 = runtime_window_q15;
+		}
+#endif
+
+		float range_gain = 0;
+		for(uint16_t i = 0; i < radar_configuration.samples_per_chirp; ++i)
+		{
+			range_gain += (float) window_q15[i];
+		}
+		range_gain /= (32768.f * (float) radar_configuration.samples_per_chirp);
+
+		float doppler_peak = 1.f;
+		doppler_window_q31 = NULL;
+		if (doppler_window != NULL)
+		{
+			q31_t* storage = (q31_t*) allocate(ALLOCATION_DOPPLER_WINDOW_Q31, STATIC_STORAGE(doppler_window_q31_storage), radar_configuration.chirps_per_frame * sizeof(q31_t));
+			if (storage == NULL) return -8;
+			doppler_peak = window_to_fixed_point(doppler_window, radar_configuration.chirps_per_frame, NULL, storage);
+			doppler_window_q31 = storage;
+		}
+
+		range_rfft_q15 = fft_plan_cache_get_rfft_q15(radar_configuration.samples_per_chirp);
+		doppler_cfft_q31 = fft_plan_cache_get_cfft_q31(radar_configuration.chirps_per_frame);
+		if ((range_rfft_q15 == NULL) || (doppler_cfft_q31 == NULL)) return -17;
 
-	// Generate window
-	window = (float*) internal_malloc(radar_configuration.samples_per_chirp * sizeof(float));
-	if (window == NULL) return -8;
-	ifx_window_blackmanharris_f32(window, radar_configuration.samples_per_chirp);
+		const float range_upscale = (float)(radar_configuration.samples_per_chirp / 2);
+		fixed_point_range_scale = range_upscale / (32768.f * range_gain);
+		fixed_point_doppler_scale = (range_upscale * 2.f * (float) radar_configuration.chirps_per_frame * doppler_peak) / (2147483648.f * range_gain);
+	}
+
+	bin_magnitude = (float*) allocate(ALLOCATION_BIN_MAGNITUDE, STATIC_STORAGE(bin_magnitude_storage), (internal_params.bin_end - internal_params.bin_start) * sizeof(float));
+	if (bin_magnitude == NULL) return -16;
+	bin_peak = (doppler_peak_t*) allocate(ALLOCATION_BIN_PEAK, STATIC_STORAGE(bin_peak_storage), (internal_params.bin_end - internal_params.bin_start) * sizeof(doppler_peak_t));
+	if (bin_peak == NULL) return -16;
+
+	// Slow-time buffer (optional)
+	slow_time_enabled = false;
+	if (internal_params.slow_time_history != 0)
+	{
+		const uint16_t bin_count = internal_params.bin_end - internal_params.bin_start;
+		cfloat32_t* storage = (cfloat32_t*) allocate(ALLOCATION_SLOW_TIME, STATIC_STORAGE(slow_time_storage), slow_time_buffer_get_storage_size(bin_count, internal_params.slow_time_history));
+		if (storage == NULL) return -9;
+		if (slow_time_buffer_init(&slow_time, storage, bin_count, internal_params.slow_time_history) != 0) return -10;
+		slow_time_enabled = true;
+	}
+
+	// Vital signs (need the slow-time samples)
+	if (internal_params.vital_signs)
+	{
+		if (!slow_time_enabled) return -11;
+		if (internal_params.frame_repetition_time <= 0) return -12;
+		if (vital_signs_init(&vital_signs, 1.f / internal_params.frame_repetition_time) != 0) return -12;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Frame rate too low for the respiration band: vital signs suspended until a faster configuration
+ */
+static void suspend_vital_signs(presence_detection_param_t* params, float frame_repetition_time)
+{
+	if (params->vital_signs && (VITAL_SIGNS_MAX_FREQ_HZ > 0.4f / frame_repetition_time))
+	{
+		params->vital_signs = false;
+	}
+}
+
+int presence_detection_init(radar_configuration_t radar_configuration, presence_detection_param_t params)
+{
+	// Keep the parameters for presence_detection_set_radar_configuration
+	initialized = false;
+	init_params_valid = false;
+	if (params.zone_count > PRESENCE_DETECTION_MAX_ZONES) return -14;
+	if ((params.zone_count != 0) && (params.zones == NULL)) return -14;
+	if (params.zone_count != 0)
+	{
+		memcpy(init_zones, params.zones, params.zone_count * sizeof(presence_detection_zone_t));
+		params.zones = init_zones;
+	}
+	init_params = params;
+	init_params_valid = true;
+
+	suspend_vital_signs(&params, radar_configuration.frame_repetition_time);
+	int retval = configure(radar_configuration, params);
+	initialized = (retval == 0);
+	return retval;
+}
+
+int presence_detection_set_radar_configuration(radar_configuration_t radar_configuration)
+{
+	if (!init_params_valid) return -21;
+
+	// Same parameters, the buffers are reused if they are big enough
+	presence_detection_param_t params = init_params;
+	suspend_vital_signs(&params, radar_configuration.frame_repetition_time);
+
+	// Partially applied configuration: no data fed until a valid one is set
+	int retval = configure(radar_configuration, params);
+	initialized = (retval == 0);
+	return retval;
+}
+
+int presence_detection_set_frame_repetition_time(float frame_repetition_time)
+{
+	if (!initialized) return -21;
+	if (frame_repetition_time <= 0) return -12;
+
+	internal_params.frame_repetition_time = frame_repetition_time;
+
+	// The slow-time samples of the previous frame rate are not continued
+	if (slow_time_enabled)
+	{
+		slow_time_buffer_reset(&slow_time);
+	}
+
+	// Filters of the new frame rate, or suspended if it is too low
+	presence_detection_param_t params = init_params;
+	suspend_vital_signs(&params, frame_repetition_time);
+	internal_params.vital_signs = params.vital_signs;
+	if (internal_params.vital_signs)
+	{
+		if (!slow_time_enabled) return -11;
+		if (vital_signs_init(&vital_signs, 1.f / frame_repetition_time) != 0) return -12;
+	}
 
 	return 0;
 }
@@ -159,49 +735,289 @@ static float get_magnitude(cfloat32_t complex_value)
 	return magnitude;
 }
 
-static float get_max_magnitude(cfloat32_t* array, uint16_t len)
+/**
+ * @brief Maximum magnitude of a spectrum, its position and the magnitude of its neighbors
+ */
+static float get_max_magnitude(cfloat32_t* array, uint16_t len, doppler_peak_t* peak)
 {
 	float max = 0;
+	uint16_t max_idx = 0;
 	for(uint16_t i = 0; i < len; ++i)
 	{
 		float mag = get_magnitude(array[i]);
-		if (mag > max) max = mag;
+		if (mag > max)
+		{
+			max = mag;
+			max_idx = i;
+		}
 	}
+
+	peak->index = max_idx;
+	peak->left = get_magnitude(array[(max_idx + len - 1) % len]);
+	peak->right = get_magnitude(array[(max_idx + 1) % len]);
 	return max;
 }
 
-void presence_detection_feed(uint16_t * frame_samples)
+/**
+ * @brief Maximum magnitude of a Q31 spectrum, its position and the magnitude of its neighbors, converted to the float scale
+ */
+static float get_max_magnitude_q31(const q31_t* array, uint16_t len, doppler_peak_t* peak)
+{
+	q31_t max = 0;
+	uint16_t max_idx = 0;
+	for(uint16_t i = 0; i < len; ++i)
+	{
+		q31_t mag;
+		arm_cmplx_mag_q31(&array[2 * i], &mag, 1);
+		if (mag > max)
+		{
+			max = mag;
+			max_idx = i;
+		}
+	}
+
+	q31_t left, right;
+	arm_cmplx_mag_q31(&array[2 * ((max_idx + len - 1) % len)], &left, 1);
+	arm_cmplx_mag_q31(&array[2 * ((max_idx + 1) % len)], &right, 1);
+
+	// 2.30 -> same scale as the complex values
+	const float scale = 2.f * fixed_point_doppler_scale;
+	peak->index = max_idx;
+	peak->left = (float) left * scale;
+	peak->right = (float) right * scale;
+	return (float) max * scale;
+}
+
+/**
+ * @brief Value of the range cube (antenna 0) in the float scale, whatever the arithmetic
+ */
+static cfloat32_t get_range_value(uint16_t chirp_idx, uint16_t bin_idx)
+{
+	if (internal_params.arithmetic == PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT)
+	{
+		const uint32_t index = (uint32_t) chirp_idx * ROI_BIN_COUNT + (bin_idx - internal_params.bin_start);
+		const q15_t* value = &((const q15_t*) range)[2 * index];
+		cfloat32_t result;
+		CREAL_F32(result) = (float) value[0] * fixed_point_range_scale;
+		CIMAG_F32(result) = (float) value[1] * fixed_point_range_scale;
+		return result;
+	}
+	return range_cube_get(&range_cube, chirp_idx, bin_idx);
+}
+
+/**
+ * @brief Position of the true maximum relative to the center bin [-0.5, 0.5]
+ * Gaussian interpolation (parabola through the log of the magnitudes) if possible, quadratic otherwise
+ */
+static float interpolate_peak(float left, float center, float right)
+{
+	if ((left > 0) && (right > 0))
+	{
+		left = logf(left);
+		center = logf(center);
+		right = logf(right);
+	}
+
+	const float denominator = left - 2.f * center + right;
+	if (denominator >= 0) return 0; // Not a maximum
+
+	float offset = 0.5f * (left - right) / denominator;
+	if (offset > 0.5f) offset = 0.5f;
+	else if (offset < -0.5f) offset = -0.5f;
+	return offset;
+}
+
+static float fractional_bin_to_meters(float bin)
+{
+	// Bin of the range grid -> bin of the native FFT
+	const float native_len = (float)(internal_params.samples_per_chirp / 2);
+	bin = bin * native_len / (float) RANGE_FFT_LEN;
+
+	const float bandwidth = (float) internal_params.end_freq - (float) internal_params.start_freq;
+	const float fftlen = native_len;
+	const float fractionfs = bin / ((fftlen - 1) * 2);
+	const float freq = fractionfs * (float) internal_params.sampling_rate;
+	const float slope = bandwidth / ((float)internal_params.samples_per_chirp * (1.f / (float)internal_params.sampling_rate));
+	return (299792458.f * freq) / (2.f * slope);
+}
+
+/**
+ * @brief Interpolate the peak of a zone in range and Doppler
+ * Uses the magnitudes and the Doppler peaks kept by the Doppler pass of the frame (no FFT)
+ */
+static void compute_result(presence_detection_internal_zone_t* zone, float magnitude, uint16_t bin)
+{
+	presence_detection_result_t* result = &zone->result;
+	const uint16_t chirps = CHIRPS_PER_FRAME;
+
+	result->magnitude = magnitude;
+	result->bin = bin;
+
+	// Range: use the maximum magnitude of the neighbor bins (if computed)
+	float range_offset = 0;
+	if ((bin > internal_params.bin_start) && (bin + 1 < internal_params.bin_end))
+	{
+		const float* mag = &bin_magnitude[bin - internal_params.bin_start];
+		range_offset = interpolate_peak(mag[-1], mag[0], mag[1]);
+	}
+	result->range_bin = (float) bin + range_offset;
+	result->distance = fractional_bin_to_meters(result->range_bin);
+
+	// Doppler: peak of the bin with the 0 frequency centered (no interpolation across the edges of the shifted spectrum)
+	const doppler_peak_t* peak = &bin_peak[bin - internal_params.bin_start];
+	const uint16_t max_idx = (peak->index + chirps / 2) % chirps;
+	float doppler_offset = 0;
+	if ((max_idx > 0) && (max_idx + 1 < chirps))
+	{
+		doppler_offset = interpolate_peak(peak->left, magnitude, peak->right);
+	}
+	result->doppler_bin = (float) max_idx - (float)(chirps / 2) + doppler_offset;
+
+	// v = fd * lambda / 2 with fd = doppler_bin / (chirps * Tc)
+	const float center_freq = ((float) internal_params.start_freq + (float) internal_params.end_freq) / 2.f;
+	const float lambda = 299792458.f / center_freq;
+	result->velocity = (result->doppler_bin * lambda) / (2.f * (float) chirps * internal_params.chirp_repetition_time);
+}
+
+/**
+ * @brief Store the slow-time sample of each bin for the current frame
+ * The slow-time sample of a bin is the mean over the chirps of the range FFT (antenna 0)
+ */
+static void update_slow_time()
+{
+	const float norm = 1.f / (float) CHIRPS_PER_FRAME;
+
+	for(uint16_t bin_idx = internal_params.bin_start; bin_idx < internal_params.bin_end; ++bin_idx)
+	{
+		cfloat32_t sum = { 0 };
+		for (uint16_t chirp_idx = 0; chirp_idx < CHIRPS_PER_FRAME; ++chirp_idx)
+		{
+			const cfloat32_t value = get_range_value(chirp_idx, bin_idx);
+			CREAL_F32(sum) += CREAL_F32(value);
+			CIMAG_F32(sum) += CIMAG_F32(value);
+		}
+		CREAL_F32(sum) *= norm;
+		CIMAG_F32(sum) *= norm;
+
+		slow_time_buffer_set(&slow_time, bin_idx - internal_params.bin_start, sum);
+	}
+
+	slow_time_buffer_advance(&slow_time);
+}
+
+/**
+ * @brief Compute the range FFT of consecutive chirps of the frame
+ * For each chirp compute a FFT -> bins of interest stored inside "range"
+ *
+ * @param [in] chirp_samples	Samples of chirp_count chirps (same layout as a frame)
+ * @param [in] first_chirp	Index of the first chirp inside the frame
+ * @param [in] chirp_count	Number of chirps
+ */
+static void compute_range(uint16_t * chirp_samples, uint16_t first_chirp, uint16_t chirp_count)
 {
-	const uint16_t fft_len = internal_params.samples_per_chirp / 2;
+	const uint16_t roi_bin_count = ROI_BIN_COUNT;
 
-	// Compute range FFT of the frame. For each chirp compute a FFT -> output inside "range"
-	range_fft_do(frame_samples,
-			range,
-			adc_samples,
-			true,				// remove mean
-			window,				// window (Blackman Harris)
-			REQUIRED_ANTENNA_COUNT,
-			internal_params.samples_per_chirp,
-			internal_params.chirps_per_frame);
+	if (internal_params.arithmetic == PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT)
+	{
+		range_fft_do_q15(chirp_samples,
+				(q15_t*) range,
+				(q15_t*) adc_samples,
+				true,				// remove mean
+				window_q15,			// window (selected by params.range_window, Q15)
+				range_rfft_q15,
+				ANTENNA_COUNT,
+				SAMPLES_PER_CHIRP,
+				CHIRPS_PER_FRAME,
+				first_chirp,
+				chirp_count,
+				internal_params.bin_start,
+				roi_bin_count);
+	}
+	else if (range_zoom_enabled)
+	{
+		range_zoom_do_cube(chirp_samples,
+				&range_cube,
+				adc_samples,
+				range_spectrum,		// packing buffer (packed formats only)
+				true,				// remove mean
+				window,				// window (selected by params.range_window, includes ADC scaling)
+				&range_zoom,
+				ANTENNA_COUNT,
+				SAMPLES_PER_CHIRP,
+				CHIRPS_PER_FRAME,
+				first_chirp,
+				chirp_count);
+	}
+	else
+	{
+		range_fft_do_cube(chirp_samples,
+				&range_cube,
+				adc_samples,
+				range_spectrum,		// complete spectrum of one chirp (if only a part is stored or packed)
+				true,				// remove mean
+				window,				// window (selected by params.range_window, includes ADC scaling)
+				range_rfft,
+				ANTENNA_COUNT,
+				SAMPLES_PER_CHIRP,
+				CHIRPS_PER_FRAME,
+				first_chirp,
+				chirp_count);
+	}
+}
+
+/**
+ * @brief Run the detection on the complete range cube (all the chirps of the frame are computed)
+ *
+ * @param [out] frame_result	Results of the frame. If NULL, the state changes are reported to the listener
+ */
+static void detect_frame(presence_detection_frame_result_t* frame_result)
+{
+	const uint16_t roi_bin_count = ROI_BIN_COUNT;
+	const bool fixed_point = (internal_params.arithmetic == PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT);
+
+	if (slow_time_enabled)
+	{
+		update_slow_time();
+	}
 
 	// Compute Doppler FFT for each bin (only for antenna 0 to save time)
-	// Bin index from [0] to [(samples per chirp / 2) - 1]
-	// and extract maximum
+	// Bin index from [bin_start] to [bin_end - 1] (only these bins are stored)
+	// Each bin is processed once, even if several zones overlap
 	float maximum_doppler = 0;
-	uint16_t max_bin_idx = 0;
+	uint16_t max_bin_idx = internal_params.bin_start;
 	for(uint16_t bin_idx = internal_params.bin_start; bin_idx < internal_params.bin_end; ++bin_idx)
 	{
-		doppler_fft_bin_do(range,
-				doppler_out,		// Doppler FFT output (size is chirps_per_frame)
-				true,				// Remove mean (0 m/s speed)
-				NULL,				// Window
-				bin_idx,			// Bin index
-				0, 					// Antenna index
-				internal_params.chirps_per_frame,
-				fft_len);
-
-		// Get maximum amplitude
-		float max_magnitude = get_max_magnitude(doppler_out, internal_params.chirps_per_frame);
+		float max_magnitude;
+		if (fixed_point)
+		{
+			doppler_fft_bin_do_q31((const q15_t*) range,
+					(q31_t*) doppler_out,	// Doppler FFT output (same size as the float one)
+					true,					// Remove mean (0 m/s speed)
+					doppler_window_q31,		// Window (NULL -> rectangular)
+					doppler_cfft_q31,
+					bin_idx - internal_params.bin_start,	// Bin index inside the region of interest
+					0,						// Antenna index
+					CHIRPS_PER_FRAME,
+					roi_bin_count);
+
+			// Get maximum amplitude (float scale -> same thresholds)
+			max_magnitude = get_max_magnitude_q31((const q31_t*) doppler_out, CHIRPS_PER_FRAME, &bin_peak[bin_idx - internal_params.bin_start]);
+		}
+		else
+		{
+			doppler_fft_bin_do_cube(&range_cube,
+					doppler_out,		// Doppler FFT output (size is chirps_per_frame)
+					true,				// Remove mean (0 m/s speed)
+					doppler_window,		// Window (NULL -> rectangular)
+					doppler_cfft,
+					bin_idx,			// Bin index
+					0, 					// Antenna index
+					CHIRPS_PER_FRAME);
+
+			// Get maximum amplitude
+			max_magnitude = get_max_magnitude(doppler_out, CHIRPS_PER_FRAME, &bin_peak[bin_idx - internal_params.bin_start]);
+		}
+		bin_magnitude[bin_idx - internal_params.bin_start] = max_magnitude;
 		if (max_magnitude > maximum_doppler)
 		{
 			maximum_doppler = max_magnitude;
@@ -209,29 +1025,173 @@ void presence_detection_feed(uint16_t * frame_samples)
 		}
 	}
 
+	if (internal_params.vital_signs)
+	{
+		const cfloat32_t sample = slow_time_buffer_get(&slow_time, max_bin_idx - internal_params.bin_start, 0);
+		vital_signs_update(&vital_signs, sample, max_bin_idx);
+
+#ifdef DEBUG_PHASE_CONTENT
+		const vital_signs_result_t* vs = vital_signs_get_result(&vital_signs);
+		printf("Phase: %.3f - Filtered: %.3f - Rate: %.1f (%.1f) \r\n", vs->phase, vs->filtered_phase, vs->respiration_rate, vs->confidence);
+#endif
+	}
+
 #ifdef DEBUG_AMPLITUDE
 	//printf("%.1f at index %2d\r\n", maximum_doppler, max_bin_idx);
 //	printf("Max = %d \r\n", (int) maximum_doppler);
 #endif
 
-	if (maximum_doppler > internal_params.threshold)
+	if (frame_result != NULL)
+	{
+		frame_result->magnitude = maximum_doppler;
+		frame_result->bin = max_bin_idx;
+	}
+
+	// Update the state of each zone
+	for(uint8_t zone_idx = 0; zone_idx < internal_params.zone_count; ++zone_idx)
 	{
-		// Above threshold, compute the angle for the max magnitude bin
-		float angle = 0;
+		presence_detection_internal_zone_t* zone = &zones[zone_idx];
 
-		if (internal_listener != NULL)
+		float zone_maximum = 0;
+		uint16_t zone_max_bin_idx = zone->bin_start;
+		for(uint16_t bin_idx = zone->bin_start; bin_idx < zone->bin_end; ++bin_idx)
 		{
-			internal_listener(maximum_doppler, max_bin_idx, angle);
+			const float magnitude = bin_magnitude[bin_idx - internal_params.bin_start];
+			if (magnitude > zone_maximum)
+			{
+				zone_maximum = magnitude;
+				zone_max_bin_idx = bin_idx;
+			}
 		}
+
+		const presence_state_t previous_state = zone->state.state;
+		const bool changed = presence_state_update(&zone->state, zone_maximum);
+		if (changed || (zone->state.state != PRESENCE_STATE_ABSENT))
+		{
+			compute_result(zone, zone_maximum, zone_max_bin_idx);
+		}
+
+		if (frame_result != NULL)
+		{
+			presence_detection_zone_frame_result_t* zone_result = &frame_result->zones[zone_idx];
+			zone_result->state = zone->state.state;
+			zone_result->changed = changed;
+			zone_result->magnitude = zone_maximum;
+			zone_result->peak = zone->result;
+		}
+		else if (changed)
+		{
+			// State changed, compute the angle for the max magnitude bin
+			presence_detection_event_t event;
+			event.zone = zone_idx;
+			event.state = zone->state.state;
+			event.previous_state = previous_state;
+			event.peak = zone->result;
+			event.angle = 0;
+
+			if (internal_listener != NULL)
+			{
+				internal_listener(&event);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Process one frame
+ *
+ * @param [out] frame_result	Results of the frame. If NULL, the state changes are reported to the listener
+ */
+static void process_frame(uint16_t * frame_samples, presence_detection_frame_result_t* frame_result)
+{
+	compute_range(frame_samples, 0, CHIRPS_PER_FRAME);
+	detect_frame(frame_result);
+	next_chirp = 0;
+}
+
+int presence_detection_feed(uint16_t * frame_samples)
+{
+	if (!initialized) return -21;
+
+	process_frame(frame_samples, NULL);
+	return 0;
+}
+
+int presence_detection_feed_chirps(uint16_t * chirp_samples, uint16_t first_chirp, uint16_t chirp_count)
+{
+	if (!initialized) return -21;
+	if (chirp_samples == NULL) return -1;
+	if ((chirp_count == 0) || ((first_chirp + chirp_count) > CHIRPS_PER_FRAME)) return -2;
+
+	// A chunk starting a frame drops the partial frame. Any other gap (chunk lost by the acquisition)
+	// drops the frame: the next chunks are rejected until the start of the next frame
+	if ((first_chirp != 0) && (first_chirp != next_chirp))
+	{
+		next_chirp = 0;
+		return -3;
 	}
+
+	compute_range(chirp_samples, first_chirp, chirp_count);
+	next_chirp = first_chirp + chirp_count;
+
+	if (next_chirp < CHIRPS_PER_FRAME) return 0;
+
+	detect_frame(NULL);
+	next_chirp = 0;
+	return 1;
+}
+
+int presence_detection_feed_batch(uint16_t * frames, uint32_t frame_count, presence_detection_frame_result_t* results)
+{
+	if (!initialized) return -21;
+	if (frames == NULL) return -1;
+	if (results == NULL) return -2;
+
+	// Frames are contiguous, the buffers (range cube, Doppler output...) are reused from frame to frame
+	const uint32_t frame_size = (uint32_t) ANTENNA_COUNT * CHIRPS_PER_FRAME * SAMPLES_PER_CHIRP;
+	for(uint32_t frame_idx = 0; frame_idx < frame_count; ++frame_idx)
+	{
+		process_frame(&frames[frame_idx * frame_size], &results[frame_idx]);
+	}
+
+	return 0;
+}
+
+uint8_t presence_detection_get_zone_count()
+{
+	return internal_params.zone_count;
+}
+
+presence_state_t presence_detection_get_state(uint8_t zone)
+{
+	if (zone >= internal_params.zone_count) return PRESENCE_STATE_ABSENT;
+	return zones[zone].state.state;
+}
+
+const slow_time_buffer_t* presence_detection_get_slow_time_buffer()
+{
+	if (!slow_time_enabled) return NULL;
+	return &slow_time;
+}
+
+const vital_signs_result_t* presence_detection_get_vital_signs()
+{
+	if (!internal_params.vital_signs) return NULL;
+	return vital_signs_get_result(&vital_signs);
+}
+
+int presence_detection_get_result(uint8_t zone, presence_detection_result_t* result)
+{
+	if (zone >= internal_params.zone_count) return -1;
+	*result = zones[zone].result;
+	return 0;
 }
 
 float presence_detection_bin_to_meters(uint16_t bin)
 {
-	const float bandwidth = (float) internal_params.end_freq - (float) internal_params.start_freq;
-	const float fftlen = internal_params.samples_per_chirp / 2;
-	const float fractionfs = (float) bin / ((fftlen - 1) * 2);
-	const float freq = fractionfs * (float) internal_params.sampling_rate;
-	const float slope = bandwidth / ((float)internal_params.samples_per_chirp * (1.f / (float)internal_params.sampling_rate));
-	return (299792458.f * freq) / (2.f * slope);
+	if (use_radar_tables && (RANGE_FFT_LEN == RADAR_TABLES_NUM_SAMPLES_PER_CHIRP / 2) && (bin < RADAR_TABLES_NUM_SAMPLES_PER_CHIRP / 2))
+	{
+		return radar_tables_range_axis[bin];
+	}
+	return fractional_bin_to_meters((float) bin);
 }
@@ -17,23 +17,142 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
+
+#include "slow_time_buffer.h"
+#include "vital_signs.h"
+#include "presence_state.h"
+#include "range_cube.h"
+#include "window.h"
+
+/**
+ * @def PRESENCE_DETECTION_MAX_ZONES
+ * @brief Maximum number of range zones monitored simultaneously
+ */
+#define PRESENCE_DETECTION_MAX_ZONES	4
+
+/**
+ * Arithmetic used by the range and Doppler processing
+ */
+typedef enum
+{
+	PRESENCE_DETECTION_ARITHMETIC_FLOAT = 0,	/**< Float (default) */
+	PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT,	/**< Q15 range FFT, Q31 Doppler FFT (range cube is half the size)
+												 * The magnitudes are rescaled to the float scale: same thresholds */
+} presence_detection_arithmetic_t;
 
 typedef void* (*malloc_func_t)(size_t size);
 typedef void (*free_func_t)(void* ptr);
 
+/**
+ * Peak of a zone, interpolated between the bins in range and in Doppler
+ */
+typedef struct
+{
+	float magnitude;		/**< Maximum magnitude (not interpolated, comparable to the thresholds) */
+	uint16_t bin;			/**< Range bin of the maximum magnitude */
+	float range_bin;		/**< Interpolated (fractional) range bin */
+	float distance;			/**< Distance in meters computed from range_bin */
+	float doppler_bin;		/**< Interpolated Doppler bin after fftshift, relative to 0 m/s (signed) */
+	float velocity;			/**< Radial velocity in m/s computed from doppler_bin (positive Doppler frequency -> positive) */
+} presence_detection_result_t;
+
+typedef struct
+{
+	uint8_t zone;						/**< Index of the zone inside the zone table */
+	presence_state_t state;				/**< New state */
+	presence_state_t previous_state;	/**< State before the transition */
+	presence_detection_result_t peak;	/**< Peak of the frame that triggered the transition */
+	float angle;
+} presence_detection_event_t;
+
+/**
+ * Result of one zone for one frame (batch processing)
+ */
+typedef struct
+{
+	presence_state_t state;				/**< State after the frame */
+	bool changed;						/**< True if the state changed during the frame (event of the single frame API) */
+	float magnitude;					/**< Maximum magnitude of the zone during the frame */
+	presence_detection_result_t peak;	/**< Last peak of the zone (only updated while the zone is not ABSENT) */
+} presence_detection_zone_frame_result_t;
+
+/**
+ * Result of one frame (batch processing)
+ */
+typedef struct
+{
+	float magnitude;	/**< Maximum magnitude of the complete region of interest */
+	uint16_t bin;		/**< Range bin of this maximum */
+	presence_detection_zone_frame_result_t zones[PRESENCE_DETECTION_MAX_ZONES];	/**< Index 0 to [zone count - 1] are valid */
+} presence_detection_frame_result_t;
+
 /**
  * @brief Listener function enabling to get notified when an event occured
+ * Only called when the presence state changes
  */
-typedef void (*presence_detection_listener_func_t)(float magnitude, uint16_t bin, float angle);
+typedef void (*presence_detection_listener_func_t)(const presence_detection_event_t* event);
+
+/**
+ * Range zone monitored independently (own thresholds and own state)
+ */
+typedef struct
+{
+	float start;			/**< Start of the zone in meters */
+	float end;				/**< End of the zone in meters */
+	float threshold;		/**< Enter threshold of the zone */
+	float threshold_exit;	/**< Exit threshold of the zone (<= threshold) */
+} presence_detection_zone_t;
 
 typedef struct
 {
-	float threshold;		/**< Threshold used to detect a presence */
+	float threshold;		/**< Threshold used to detect a presence (enter threshold) */
+	float threshold_exit;	/**< Once present, the magnitude must stay above this threshold (<= threshold) */
+	uint16_t confirm_frames;	/**< Consecutive frames above threshold needed to report a presence */
+	uint16_t hold_frames;		/**< Consecutive frames below threshold_exit tolerated before reporting an absence */
 
 	/**< User can select the range to be controlled
 	 * If bin_start == bin_end -> complete range */
 	uint16_t bin_start;
 	uint16_t bin_end;
+
+	/**< Zone table (copied during init). If zone_count == 0, a single zone defined by
+	 * bin_start, bin_end, threshold and threshold_exit is used */
+	const presence_detection_zone_t* zones;
+	uint8_t zone_count;
+
+	/**< Number of frames stored per bin inside the slow-time buffer
+	 * 0 -> slow-time buffer disabled */
+	uint16_t slow_time_history;
+
+	/**< Track the phase of the maximum bin and estimate the respiration rate
+	 * Requires the slow-time buffer (slow_time_history != 0, only the sample of the current frame is read: 1 is enough) */
+	bool vital_signs;
+
+	/**< Float or fixed-point processing */
+	presence_detection_arithmetic_t arithmetic;
+
+	/**< Storage of the range cube (float pipeline only): RANGE_CUBE_FORMAT_FLOAT16 and RANGE_CUBE_FORMAT_BFP16
+	 * halve the largest buffer, the values are expanded to float when gathered by the Doppler FFT */
+	range_cube_format_t range_cube_format;
+
+	/**< 0 or 1 -> native range FFT grid
+	 * > 1 -> zoom DFT with range_zoom bins per native bin, computed only between bin_start and bin_end
+	 * (cost proportional to the region of interest). bin_start and bin_end are bins of the native FFT,
+	 * all the reported bins (presence_detection_result_t, presence_detection_bin_to_meters) are bins of the fine grid
+	 * Float pipeline and runtime configuration only */
+	uint8_t range_zoom;
+
+	/**< 0 or 1 -> no zero padding
+	 * 2, 4, 8... -> range FFT of samples_per_chirp * range_fft_padding points (range_fft_padding bins per native bin),
+	 * only the bins between bin_start and bin_end are stored. Same bin conventions as range_zoom (exclusive with it)
+	 * Float pipeline and runtime configuration only */
+	uint8_t range_fft_padding;
+
+	/**< Windows of the range and Doppler FFTs (WINDOW_NONE -> rectangular)
+	 * The windows are normalized by their coherent gain: a threshold works for every window */
+	window_type_t range_window;
+	window_type_t doppler_window;
 } presence_detection_param_t;
 
 typedef struct
@@ -44,14 +163,46 @@ typedef struct
 	uint32_t sampling_rate;
 	uint64_t start_freq;
 	uint64_t end_freq;
+	float chirp_repetition_time;	/**< Time between two chirps in seconds */
+	float frame_repetition_time;	/**< Time between two frames in seconds */
 } radar_configuration_t;
 
 void presence_detection_set_malloc_free(malloc_func_t malloc, free_func_t free);
 
 void presence_detection_set_listener(presence_detection_listener_func_t listener);
 
+/**
+ * @brief Configure the algorithm
+ * If the frame rate is too low for the vital signs, they are suspended as by presence_detection_set_radar_configuration
+ */
 int presence_detection_init(radar_configuration_t radar_configuration, presence_detection_param_t params);
 
+/**
+ * @brief Change the radar configuration (e.g. radar profile switched at runtime) keeping the parameters
+ * of the last presence_detection_init (the zone table is copied by presence_detection_init)
+ * Runtime configuration: the buffers are reused if they are big enough, else they are reallocated
+ * Static configuration: only the configuration of radar_settings.h is supported
+ * The detection restarts (all zones absent, partial frame dropped)
+ * If the frame rate is too low for the vital signs, they are suspended (presence_detection_get_vital_signs returns NULL)
+ * until a configuration with a higher frame rate is set
+ *
+ * @retval 0 Success
+ * @retval -21 presence_detection_init not called or rejected its parameters
+ * @retval Other Error of presence_detection_init: the feed functions return -21 until a valid configuration is set
+ */
+int presence_detection_set_radar_configuration(radar_configuration_t radar_configuration);
+
+/**
+ * @brief Change only the frame repetition time (e.g. duty cycling of the frame rate), the detection goes on
+ * The slow-time buffer restarts, the vital signs restart at the new frame rate or are suspended if it is too low
+ *
+ * @retval 0 Success
+ * @retval -21 presence_detection_init not called or failed
+ * @retval -12 Invalid frame repetition time
+ * @retval -11 Vital signs without slow-time buffer
+ */
+int presence_detection_set_frame_repetition_time(float frame_repetition_time);
+
 /**
  * @brief Feed the algorithm with data
  *
@@ -59,9 +210,89 @@ int presence_detection_init(radar_configuration_t radar_configuration, presence_
  * 								The data are "interleaved":
  * 								frame_samples[0] -> sample 0 of antenna 0
  * 								frame_samples[1] -> sample 0 of antenna 1
+ *
+ * @retval 0 Success
+ * @retval -21 No valid configuration (presence_detection_init or presence_detection_set_radar_configuration failed)
  */
-void presence_detection_feed(uint16_t * frame_samples);
+int presence_detection_feed(uint16_t * frame_samples);
 
+/**
+ * @brief Feed the algorithm with a part of a frame (streaming, e.g. FIFO watermark of a few chirps)
+ * The range FFT of the chirps is computed immediately, the Doppler processing and the detection
+ * run when the last chirp of the frame is received (the listener is called as for presence_detection_feed)
+ *
+ * @param [in] chirp_samples	chirp_count consecutive chirps (same layout as presence_detection_feed)
+ * @param [in] first_chirp	Index of the first chirp inside the frame. 0 starts a new frame
+ * @param [in] chirp_count	Number of chirps
+ *
+ * @retval 1 Frame completed, detection done
+ * @retval 0 Chirps stored, frame not completed
+ * @retval -1 Invalid chirp_samples
+ * @retval -2 Invalid first_chirp or chirp_count
+ * @retval -3 Chirps missing (first_chirp is not the next expected chirp), the frame is dropped
+ * @retval -21 No valid configuration (see presence_detection_feed)
+ */
+int presence_detection_feed_chirps(uint16_t * chirp_samples, uint16_t first_chirp, uint16_t chirp_count);
+
+/**
+ * @brief Feed the algorithm with several frames (offline replay, parameter sweeps)
+ * Same processing as presence_detection_feed for each frame, but the listener is not called:
+ * the results of each frame are written inside results
+ *
+ * @param [in] frames	frame_count contiguous frames (same layout as presence_detection_feed)
+ * @param [in] frame_count	Number of frames
+ * @param [out] results	Results, one per frame (size is frame_count)
+ *
+ * @retval 0 Success
+ * @retval -1 Invalid frames
+ * @retval -2 Invalid results
+ * @retval -21 No valid configuration (see presence_detection_feed)
+ */
+int presence_detection_feed_batch(uint16_t * frames, uint32_t frame_count, presence_detection_frame_result_t* results);
+
+/**
+ * @brief Distance in meters of a bin of the range grid (native FFT, zoom DFT or zero-padded FFT)
+ */
 float presence_detection_bin_to_meters(uint16_t bin);
 
+/**
+ * @brief Get the slow-time buffer
+ * The buffer contains one sample per frame for each bin between bin_start and bin_end
+ * (index 0 of the buffer corresponds to bin_start)
+ *
+ * @retval NULL if the slow-time buffer is disabled (slow_time_history == 0)
+ */
+const slow_time_buffer_t* presence_detection_get_slow_time_buffer();
+
+/**
+ * @brief Get the last vital-sign estimation (phase of the maximum bin and respiration rate)
+ *
+ * @retval NULL if the vital-sign estimation is disabled
+ */
+const vital_signs_result_t* presence_detection_get_vital_signs();
+
+/**
+ * @brief Get the number of monitored zones
+ */
+uint8_t presence_detection_get_zone_count();
+
+/**
+ * @brief Get the current presence state of a zone
+ *
+ * @param [in] zone	Index of the zone [0] to [zone count - 1]
+ */
+presence_state_t presence_detection_get_state(uint8_t zone);
+
+/**
+ * @brief Get the last peak of a zone
+ * Only updated while the zone is not ABSENT
+ *
+ * @param [in] zone	Index of the zone [0] to [zone count - 1]
+ * @param [out] result	Interpolated peak
+ *
+ * @retval 0 Success
+ * @retval -1 Invalid zone
+ */
+int presence_detection_get_result(uint8_t zone, presence_detection_result_t* result);
+
 #endif /* PRESENCE_DETECTION_PRESENCE_DETECTION_H_ */
@@ -16,6 +16,18 @@
 #define PRESENCE_DETECTION_PRESENCE_DETECTION_INTERNAL_H_
 
 #include <stdint.h>
+#include <stdbool.h>
+
+#include "presence_detection.h"
+
+typedef struct
+{
+	uint16_t bin_start;
+	uint16_t bin_end;
+
+	presence_state_machine_t state;
+	presence_detection_result_t result;
+} presence_detection_internal_zone_t;
 
 typedef struct
 {
@@ -25,11 +37,28 @@ typedef struct
 	uint32_t sampling_rate;
 	uint64_t start_freq;
 	uint64_t end_freq;
+	float chirp_repetition_time;
+	float frame_repetition_time;
 
-	uint16_t bin_start;
+	uint16_t range_fft_len;	/**< Number of bins of the range grid (samples per chirp / 2 * zoom or padding) */
+
+	uint16_t bin_start;		/**< Union of all zones */
 	uint16_t bin_end;
 
+	uint8_t zone_count;
+
 	float threshold;
+	float threshold_exit;
+	uint16_t confirm_frames;
+	uint16_t hold_frames;
+
+	uint16_t slow_time_history;
+	bool vital_signs;
+
+	presence_detection_arithmetic_t arithmetic;
+	range_cube_format_t range_cube_format;
+	window_type_t range_window;
+	window_type_t doppler_window;
 } presence_detection_internal_param_t;
 
 #endif /* PRESENCE_DETECTION_PRESENCE_DETECTION_INTERNAL_H_ */
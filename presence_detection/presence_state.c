@@ -0,0 +1,58 @@
+/*
+ * presence_state.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "presence_state.h"
+
+void presence_state_init(presence_state_machine_t* sm, presence_state_param_t params)
+{
+	sm->params = params;
+	sm->state = PRESENCE_STATE_ABSENT;
+	sm->counter = 0;
+}
+
+bool presence_state_update(presence_state_machine_t* sm, float magnitude)
+{
+	const presence_state_t previous = sm->state;
+
+	switch(sm->state)
+	{
+		case PRESENCE_STATE_ABSENT:
+		case PRESENCE_STATE_CANDIDATE:
+			if (magnitude > sm->params.threshold_enter)
+			{
+				sm->counter = (sm->state == PRESENCE_STATE_ABSENT) ? 1 : sm->counter + 1;
+				sm->state = (sm->counter >= sm->params.confirm_frames) ? PRESENCE_STATE_PRESENT : PRESENCE_STATE_CANDIDATE;
+			}
+			else
+			{
+				sm->state = PRESENCE_STATE_ABSENT;
+			}
+			break;
+
+		case PRESENCE_STATE_PRESENT:
+		case PRESENCE_STATE_HOLDING:
+			if (magnitude > sm->params.threshold_exit)
+			{
+				sm->state = PRESENCE_STATE_PRESENT;
+			}
+			else
+			{
+				sm->counter = (sm->state == PRESENCE_STATE_PRESENT) ? 1 : sm->counter + 1;
+				sm->state = (sm->counter > sm->params.hold_frames) ? PRESENCE_STATE_ABSENT : PRESENCE_STATE_HOLDING;
+			}
+			break;
+	}
+
+	return (previous != sm->state);
+}
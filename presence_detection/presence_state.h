@@ -0,0 +1,63 @@
+/*
+ * presence_state.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef PRESENCE_DETECTION_PRESENCE_STATE_H_
+#define PRESENCE_DETECTION_PRESENCE_STATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * States of the presence detection
+ * ABSENT -> CANDIDATE -> PRESENT -> HOLDING -> ABSENT
+ */
+typedef enum
+{
+	PRESENCE_STATE_ABSENT = 0,		/**< Nobody detected */
+	PRESENCE_STATE_CANDIDATE,		/**< Above enter threshold, waiting for confirmation */
+	PRESENCE_STATE_PRESENT,			/**< Presence confirmed */
+	PRESENCE_STATE_HOLDING			/**< Below exit threshold, waiting for the hold time to elapse */
+} presence_state_t;
+
+typedef struct
+{
+	float threshold_enter;		/**< Magnitude needed to become candidate / to stay candidate */
+	float threshold_exit;		/**< Magnitude needed to stay present (threshold_exit <= threshold_enter) */
+	uint16_t confirm_frames;	/**< Number of consecutive frames above threshold_enter needed to become PRESENT */
+	uint16_t hold_frames;		/**< Number of consecutive frames below threshold_exit tolerated before ABSENT */
+} presence_state_param_t;
+
+typedef struct
+{
+	presence_state_param_t params;
+	presence_state_t state;
+	uint16_t counter;
+} presence_state_machine_t;
+
+/**
+ * @brief Initialize the state machine (state is ABSENT)
+ */
+void presence_state_init(presence_state_machine_t* sm, presence_state_param_t params);
+
+/**
+ * @brief Update the state machine with the magnitude of the current frame
+ *
+ * @param [inout] sm	State machine
+ * @param [in] magnitude	Maximum magnitude measured inside the current frame
+ *
+ * @retval true if the state changed
+ */
+bool presence_state_update(presence_state_machine_t* sm, float magnitude);
+
+#endif /* PRESENCE_DETECTION_PRESENCE_STATE_H_ */
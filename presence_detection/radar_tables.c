@@ -0,0 +1,274 @@
+/*
+ * radar_tables.c
+ *
+ * Generated by scripts/generate_radar_tables.py from radar_settings.h
+ * Do not edit: modify radar_settings.h and rebuild instead.
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "radar_tables.h"
+
+#include "arm_common_tables.h"
+#include "arm_const_structs.h"
+
+const float32_t radar_tables_range_window[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_SAMPLES_PER_CHIRP] = {
+	/* WINDOW_NONE */
+	{
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f, 2.441406250e-04f,
+		2.441406250e-04f, 2.441406250e-04f,
+	},
+	/* WINDOW_HANN */
+	{
+		0.000000000e+00f, 3.010786874e-07f, 1.203577960e-06f, 2.705289250e-06f, 4.802537619e-06f, 7.490190748e-06f,
+		1.076167150e-05f, 1.460897401e-05f, 1.902268330e-05f, 2.399199826e-05f, 2.950475816e-05f, 3.554747234e-05f,
+		4.210535328e-05f, 4.916235274e-05f, 5.670120105e-05f, 6.470344941e-05f, 7.314951495e-05f, 8.201872875e-05f,
+		9.128938635e-05f, 1.009388009e-04f, 1.109433587e-04f, 1.212785768e-04f, 1.319191633e-04f, 1.428390789e-04f,
+		1.540116007e-04f, 1.654093877e-04f, 1.770045476e-04f, 1.887687051e-04f, 2.006730713e-04f, 2.126885142e-04f,
+		2.247856300e-04f, 2.369348152e-04f, 2.491063385e-04f, 2.612704142e-04f, 2.733972749e-04f, 2.854572439e-04f,
+		2.974208086e-04f, 3.092586922e-04f, 3.209419253e-04f, 3.324419170e-04f, 3.437305251e-04f, 3.547801243e-04f,
+		3.655636746e-04f, 3.760547866e-04f, 3.862277869e-04f, 3.960577805e-04f, 4.055207116e-04f, 4.145934231e-04f,
+		4.232537123e-04f, 4.314803861e-04f, 4.392533125e-04f, 4.465534699e-04f, 4.533629934e-04f, 4.596652191e-04f,
+		4.654447243e-04f, 4.706873657e-04f, 4.753803136e-04f, 4.795120836e-04f, 4.830725645e-04f, 4.860530433e-04f,
+		4.884462262e-04f, 4.902462567e-04f, 4.914487299e-04f, 4.920507031e-04f, 4.920507031e-04f, 4.914487299e-04f,
+		4.902462567e-04f, 4.884462262e-04f, 4.860530433e-04f, 4.830725645e-04f, 4.795120836e-04f, 4.753803136e-04f,
+		4.706873657e-04f, 4.654447243e-04f, 4.596652191e-04f, 4.533629934e-04f, 4.465534699e-04f, 4.392533125e-04f,
+		4.314803861e-04f, 4.232537123e-04f, 4.145934231e-04f, 4.055207116e-04f, 3.960577805e-04f, 3.862277869e-04f,
+		3.760547866e-04f, 3.655636746e-04f, 3.547801243e-04f, 3.437305251e-04f, 3.324419170e-04f, 3.209419253e-04f,
+		3.092586922e-04f, 2.974208086e-04f, 2.854572439e-04f, 2.733972749e-04f, 2.612704142e-04f, 2.491063385e-04f,
+		2.369348152e-04f, 2.247856300e-04f, 2.126885142e-04f, 2.006730713e-04f, 1.887687051e-04f, 1.770045476e-04f,
+		1.654093877e-04f, 1.540116007e-04f, 1.428390789e-04f, 1.319191633e-04f, 1.212785768e-04f, 1.109433587e-04f,
+		1.009388009e-04f, 9.128938635e-05f, 8.201872875e-05f, 7.314951495e-05f, 6.470344941e-05f, 5.670120105e-05f,
+		4.916235274e-05f, 4.210535328e-05f, 3.554747234e-05f, 2.950475816e-05f, 2.399199826e-05f, 1.902268330e-05f,
+		1.460897401e-05f, 1.076167150e-05f, 7.490190748e-06f, 4.802537619e-06f, 2.705289250e-06f, 1.203577960e-06f,
+		3.010786874e-07f, 0.000000000e+00f,
+	},
+	/* WINDOW_HAMMING */
+	{
+		3.641130207e-05f, 3.666747767e-05f, 3.743537758e-05f, 3.871312260e-05f, 4.049758590e-05f, 4.278440058e-05f,
+		4.556797042e-05f, 4.884148357e-05f, 5.259692919e-05f, 5.682511707e-05f, 6.151570014e-05f, 6.665719974e-05f,
+		7.223703377e-05f, 7.824154743e-05f, 8.465604669e-05f, 9.146483417e-05f, 9.865124764e-05f, 1.061977007e-04f,
+		1.140857260e-04f, 1.222960202e-04f, 1.308084913e-04f, 1.396023078e-04f, 1.486559499e-04f, 1.579472617e-04f,
+		1.674535059e-04f, 1.771514190e-04f, 1.870172687e-04f, 1.970269116e-04f, 2.071558524e-04f, 2.173793038e-04f,
+		2.276722474e-04f, 2.380094947e-04f, 2.483657485e-04f, 2.587156656e-04f, 2.690339178e-04f, 2.792952547e-04f,
+		2.894745651e-04f, 2.995469385e-04f, 3.094877261e-04f, 3.192726011e-04f, 3.288776184e-04f, 3.382792727e-04f,
+		3.474545568e-04f, 3.563810171e-04f, 3.650368091e-04f, 3.734007506e-04f, 3.814523736e-04f, 3.891719746e-04f,
+		3.965406623e-04f, 4.035404043e-04f, 4.101540710e-04f, 4.163654778e-04f, 4.221594243e-04f, 4.275217317e-04f,
+		4.324392775e-04f, 4.369000277e-04f, 4.408930661e-04f, 4.444086210e-04f, 4.474380894e-04f, 4.499740575e-04f,
+		4.520103195e-04f, 4.535418922e-04f, 4.545650277e-04f, 4.550772222e-04f, 4.550772222e-04f, 4.545650277e-04f,
+		4.535418922e-04f, 4.520103195e-04f, 4.499740575e-04f, 4.474380894e-04f, 4.444086210e-04f, 4.408930661e-04f,
+		4.369000277e-04f, 4.324392775e-04f, 4.275217317e-04f, 4.221594243e-04f, 4.163654778e-04f, 4.101540710e-04f,
+		4.035404043e-04f, 3.965406623e-04f, 3.891719746e-04f, 3.814523736e-04f, 3.734007506e-04f, 3.650368091e-04f,
+		3.563810171e-04f, 3.474545568e-04f, 3.382792727e-04f, 3.288776184e-04f, 3.192726011e-04f, 3.094877261e-04f,
+		2.995469385e-04f, 2.894745651e-04f, 2.792952547e-04f, 2.690339178e-04f, 2.587156656e-04f, 2.483657485e-04f,
+		2.380094947e-04f, 2.276722474e-04f, 2.173793038e-04f, 2.071558524e-04f, 1.970269116e-04f, 1.870172687e-04f,
+		1.771514190e-04f, 1.674535059e-04f, 1.579472617e-04f, 1.486559499e-04f, 1.396023078e-04f, 1.308084913e-04f,
+		1.222960202e-04f, 1.140857260e-04f, 1.061977007e-04f, 9.865124764e-05f, 9.146483417e-05f, 8.465604669e-05f,
+		7.824154743e-05f, 7.223703377e-05f, 6.665719974e-05f, 6.151570014e-05f, 5.682511707e-05f, 5.259692919e-05f,
+		4.884148357e-05f, 4.556797042e-05f, 4.278440058e-05f, 4.049758590e-05f, 3.871312260e-05f, 3.743537758e-05f,
+		3.666747767e-05f, 3.641130207e-05f,
+	},
+	/* WINDOW_BLACKMAN_HARRIS */
+	{
+		4.115333822e-08f, 6.504179895e-08f, 1.384044723e-07f, 2.663329103e-07f, 4.573114638e-07f, 7.232131993e-07f,
+		1.079290782e-06f, 1.544159063e-06f, 2.139765352e-06f, 2.891342761e-06f, 3.827341545e-06f, 4.979333072e-06f,
+		6.381881002e-06f, 8.072374323e-06f, 1.009081725e-05f, 1.247957145e-05f, 1.528304688e-05f, 1.854733829e-05f,
+		2.231980551e-05f, 2.664859711e-05f, 3.158211789e-05f, 3.716844253e-05f, 4.345467891e-05f, 5.048628624e-05f,
+		5.830635461e-05f, 6.695485393e-05f, 7.646786177e-05f, 8.687678048e-05f, 9.820755554e-05f, 1.104799074e-04f,
+		1.237065904e-04f, 1.378926917e-04f, 1.530349849e-04f, 1.691213513e-04f, 1.861302826e-04f, 2.040304772e-04f,
+		2.227805418e-04f, 2.423288092e-04f, 2.626132807e-04f, 2.835617006e-04f, 3.050917679e-04f, 3.271114887e-04f,
+		3.495196701e-04f, 3.722065547e-04f, 3.950545912e-04f, 4.179393362e-04f, 4.407304778e-04f, 4.632929710e-04f,
+		4.854882722e-04f, 5.071756573e-04f, 5.282136084e-04f, 5.484612495e-04f, 5.677798142e-04f, 5.860341224e-04f,
+		6.030940491e-04f, 6.188359607e-04f, 6.331441017e-04f, 6.459119087e-04f, 6.570432339e-04f, 6.664534595e-04f,
+		6.740704865e-04f, 6.798355825e-04f, 6.837040763e-04f, 6.856458883e-04f, 6.856458883e-04f, 6.837040763e-04f,
+		6.798355825e-04f, 6.740704865e-04f, 6.664534595e-04f, 6.570432339e-04f, 6.459119087e-04f, 6.331441017e-04f,
+		6.188359607e-04f, 6.030940491e-04f, 5.860341224e-04f, 5.677798142e-04f, 5.484612495e-04f, 5.282136084e-04f,
+		5.071756573e-04f, 4.854882722e-04f, 4.632929710e-04f, 4.407304778e-04f, 4.179393362e-04f, 3.950545912e-04f,
+		3.722065547e-04f, 3.495196701e-04f, 3.271114887e-04f, 3.050917679e-04f, 2.835617006e-04f, 2.626132807e-04f,
+		2.423288092e-04f, 2.227805418e-04f, 2.040304772e-04f, 1.861302826e-04f, 1.691213513e-04f, 1.530349849e-04f,
+		1.378926917e-04f, 1.237065904e-04f, 1.104799074e-04f, 9.820755554e-05f, 8.687678048e-05f, 7.646786177e-05f,
+		6.695485393e-05f, 5.830635461e-05f, 5.048628624e-05f, 4.345467891e-05f, 3.716844253e-05f, 3.158211789e-05f,
+		2.664859711e-05f, 2.231980551e-05f, 1.854733829e-05f, 1.528304688e-05f, 1.247957145e-05f, 1.009081725e-05f,
+		8.072374323e-06f, 6.381881002e-06f, 4.979333072e-06f, 3.827341545e-06f, 2.891342761e-06f, 2.139765352e-06f,
+		1.544159063e-06f, 1.079290782e-06f, 7.232131993e-07f, 4.573114638e-07f, 2.663329103e-07f, 1.384044723e-07f,
+		6.504179895e-08f, 4.115333822e-08f,
+	},
+	/* WINDOW_CHEBYSHEV */
+	{
+		2.297989119e-06f, 1.767512345e-06f, 2.431201792e-06f, 3.246329375e-06f, 4.233966462e-06f, 5.416503873e-06f,
+		6.817559289e-06f, 8.461861663e-06f, 1.037511234e-05f, 1.258382290e-05f, 1.511513004e-05f, 1.799658816e-05f,
+		2.125594065e-05f, 2.492087110e-05f, 2.901873630e-05f, 3.357628283e-05f, 3.861934966e-05f, 4.417255940e-05f,
+		5.025900102e-05f, 5.689990735e-05f, 6.411433058e-05f, 7.191881958e-05f, 8.032710250e-05f, 8.934977881e-05f,
+		9.899402443e-05f, 1.092633141e-04f, 1.201571646e-04f, 1.316709031e-04f, 1.437954639e-04f, 1.565172170e-04f,
+		1.698178319e-04f, 1.836741802e-04f, 1.980582780e-04f, 2.129372718e-04f, 2.282734693e-04f, 2.440244160e-04f,
+		2.601430189e-04f, 2.765777174e-04f, 2.932727012e-04f, 3.101681747e-04f, 3.272006665e-04f, 3.443033814e-04f,
+		3.614065943e-04f, 3.784380810e-04f, 3.953235839e-04f, 4.119873087e-04f, 4.283524465e-04f, 4.443417188e-04f,
+		4.598779385e-04f, 4.748845823e-04f, 4.892863691e-04f, 5.030098390e-04f, 5.159839268e-04f, 5.281405235e-04f,
+		5.394150223e-04f, 5.497468406e-04f, 5.590799151e-04f, 5.673631629e-04f, 5.745509060e-04f, 5.806032517e-04f,
+		5.854864272e-04f, 5.891730650e-04f, 5.916424332e-04f, 5.928806121e-04f, 5.928806121e-04f, 5.916424332e-04f,
+		5.891730650e-04f, 5.854864272e-04f, 5.806032517e-04f, 5.745509060e-04f, 5.673631629e-04f, 5.590799151e-04f,
+		5.497468406e-04f, 5.394150223e-04f, 5.281405235e-04f, 5.159839268e-04f, 5.030098390e-04f, 4.892863691e-04f,
+		4.748845823e-04f, 4.598779385e-04f, 4.443417188e-04f, 4.283524465e-04f, 4.119873087e-04f, 3.953235839e-04f,
+		3.784380810e-04f, 3.614065943e-04f, 3.443033814e-04f, 3.272006665e-04f, 3.101681747e-04f, 2.932727012e-04f,
+		2.765777174e-04f, 2.601430189e-04f, 2.440244160e-04f, 2.282734693e-04f, 2.129372718e-04f, 1.980582780e-04f,
+		1.836741802e-04f, 1.698178319e-04f, 1.565172170e-04f, 1.437954639e-04f, 1.316709031e-04f, 1.201571646e-04f,
+		1.092633141e-04f, 9.899402443e-05f, 8.934977881e-05f, 8.032710250e-05f, 7.191881958e-05f, 6.411433058e-05f,
+		5.689990735e-05f, 5.025900102e-05f, 4.417255940e-05f, 3.861934966e-05f, 3.357628283e-05f, 2.901873630e-05f,
+		2.492087110e-05f, 2.125594065e-05f, 1.799658816e-05f, 1.511513004e-05f, 1.258382290e-05f, 1.037511234e-05f,
+		8.461861663e-06f, 6.817559289e-06f, 5.416503873e-06f, 4.233966462e-06f, 3.246329375e-06f, 2.431201792e-06f,
+		1.767512345e-06f, 2.297989119e-06f,
+	},
+};
+
+const q15_t radar_tables_range_window_q15[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_SAMPLES_PER_CHIRP] = {
+	/* WINDOW_NONE */
+	{
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+		32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	},
+	/* WINDOW_HANN */
+	{
+		0, 20, 80, 180, 320, 499, 717, 973, 1267, 1597, 1965, 2367,
+		2804, 3273, 3775, 4308, 4871, 5461, 6078, 6721, 7387, 8075, 8784, 9511,
+		10255, 11014, 11786, 12569, 13362, 14162, 14967, 15776, 16587, 17397, 18204, 19007,
+		19804, 20592, 21370, 22136, 22887, 23623, 24341, 25039, 25717, 26371, 27001, 27606,
+		28182, 28730, 29247, 29734, 30187, 30607, 30991, 31341, 31653, 31928, 32165, 32364,
+		32523, 32643, 32723, 32763, 32763, 32723, 32643, 32523, 32364, 32165, 31928, 31653,
+		31341, 30991, 30607, 30187, 29734, 29247, 28730, 28182, 27606, 27001, 26371, 25717,
+		25039, 24341, 23623, 22887, 22136, 21370, 20592, 19804, 19007, 18204, 17397, 16587,
+		15776, 14967, 14162, 13362, 12569, 11786, 11014, 10255, 9511, 8784, 8075, 7387,
+		6721, 6078, 5461, 4871, 4308, 3775, 3273, 2804, 2367, 1965, 1597, 1267,
+		973, 717, 499, 320, 180, 80, 20, 0,
+	},
+	/* WINDOW_HAMMING */
+	{
+		2621, 2640, 2695, 2787, 2916, 3080, 3281, 3516, 3787, 4091, 4429, 4799,
+		5201, 5633, 6095, 6585, 7102, 7646, 8214, 8805, 9418, 10051, 10703, 11371,
+		12056, 12754, 13464, 14185, 14914, 15650, 16391, 17136, 17881, 18626, 19369, 20108,
+		20841, 21566, 22282, 22986, 23678, 24354, 25015, 25658, 26281, 26883, 27463, 28019,
+		28549, 29053, 29529, 29976, 30393, 30780, 31134, 31455, 31742, 31995, 32213, 32396,
+		32543, 32653, 32727, 32763, 32763, 32727, 32653, 32543, 32396, 32213, 31995, 31742,
+		31455, 31134, 30780, 30393, 29976, 29529, 29053, 28549, 28019, 27463, 26883, 26281,
+		25658, 25015, 24354, 23678, 22986, 22282, 21566, 20841, 20108, 19369, 18626, 17881,
+		17136, 16391, 15650, 14914, 14185, 13464, 12754, 12056, 11371, 10703, 10051, 9418,
+		8805, 8214, 7646, 7102, 6585, 6095, 5633, 5201, 4799, 4429, 4091, 3787,
+		3516, 3281, 3080, 2916, 2787, 2695, 2640, 2621,
+	},
+	/* WINDOW_BLACKMAN_HARRIS */
+	{
+		2, 3, 7, 13, 22, 35, 52, 74, 102, 138, 183, 238,
+		305, 386, 482, 596, 730, 886, 1066, 1273, 1509, 1776, 2076, 2412,
+		2786, 3199, 3653, 4150, 4692, 5278, 5910, 6588, 7311, 8080, 8892, 9747,
+		10643, 11577, 12546, 13547, 14576, 15628, 16698, 17782, 18874, 19967, 21056, 22134,
+		23194, 24230, 25235, 26202, 27125, 27997, 28813, 29565, 30248, 30858, 31390, 31839,
+		32203, 32479, 32664, 32756, 32756, 32664, 32479, 32203, 31839, 31390, 30858, 30248,
+		29565, 28813, 27997, 27125, 26202, 25235, 24230, 23194, 22134, 21056, 19967, 18874,
+		17782, 16698, 15628, 14576, 13547, 12546, 11577, 10643, 9747, 8892, 8080, 7311,
+		6588, 5910, 5278, 4692, 4150, 3653, 3199, 2786, 2412, 2076, 1776, 1509,
+		1273, 1066, 886, 730, 596, 482, 386, 305, 238, 183, 138, 102,
+		74, 52, 35, 22, 13, 7, 3, 2,
+	},
+	/* WINDOW_CHEBYSHEV */
+	{
+		127, 98, 134, 179, 234, 299, 377, 468, 573, 695, 835, 995,
+		1175, 1377, 1604, 1856, 2134, 2441, 2778, 3145, 3544, 3975, 4440, 4938,
+		5471, 6039, 6641, 7277, 7947, 8651, 9386, 10152, 10947, 11769, 12616, 13487,
+		14378, 15286, 16209, 17143, 18084, 19029, 19975, 20916, 21849, 22770, 23675, 24558,
+		25417, 26246, 27042, 27801, 28518, 29190, 29813, 30384, 30900, 31358, 31755, 32089,
+		32359, 32563, 32700, 32767, 32767, 32700, 32563, 32359, 32089, 31755, 31358, 30900,
+		30384, 29813, 29190, 28518, 27801, 27042, 26246, 25417, 24558, 23675, 22770, 21849,
+		20916, 19975, 19029, 18084, 17143, 16209, 15286, 14378, 13487, 12616, 11769, 10947,
+		10152, 9386, 8651, 7947, 7277, 6641, 6039, 5471, 4938, 4440, 3975, 3544,
+		3145, 2778, 2441, 2134, 1856, 1604, 1377, 1175, 995, 835, 695, 573,
+		468, 377, 299, 234, 179, 134, 98, 127,
+	},
+};
+
+const float32_t radar_tables_doppler_window[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_CHIRPS_PER_FRAME] = {
+	/* WINDOW_NONE */
+	{
+		1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+		1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+		1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f, 1.000000000e+00f,
+	},
+	/* WINDOW_HANN */
+	{
+		0.000000000e+00f, 9.221817851e-02f, 3.529273532e-01f, 7.370485393e-01f, 1.178163694e+00f, 1.600000000e+00f,
+		1.929618127e+00f, 2.110024107e+00f, 2.110024107e+00f, 1.929618127e+00f, 1.600000000e+00f, 1.178163694e+00f,
+		7.370485393e-01f, 3.529273532e-01f, 9.221817851e-02f, 0.000000000e+00f,
+	},
+	/* WINDOW_HAMMING */
+	{
+		1.564792176e-01f, 2.342671677e-01f, 4.541807747e-01f, 7.781949782e-01f, 1.150284779e+00f, 1.506112469e+00f,
+		1.784152210e+00f, 1.936328404e+00f, 1.936328404e+00f, 1.784152210e+00f, 1.506112469e+00f, 1.150284779e+00f,
+		7.781949782e-01f, 4.541807747e-01f, 2.342671677e-01f, 1.564792176e-01f,
+	},
+	/* WINDOW_BLACKMAN_HARRIS */
+	{
+		1.783952235e-04f, 1.070473044e-02f, 7.939108782e-02f, 3.062792944e-01f, 7.967968894e-01f, 1.547801558e+00f,
+		2.360268442e+00f, 2.898579603e+00f, 2.898579603e+00f, 2.360268442e+00f, 1.547801558e+00f, 7.967968894e-01f,
+		3.062792944e-01f, 7.939108782e-02f, 1.070473044e-02f, 1.783952235e-04f,
+	},
+	/* WINDOW_CHEBYSHEV */
+	{
+		1.699716142e-02f, 8.532997013e-02f, 2.566810240e-01f, 5.747045529e-01f, 1.039787625e+00f, 1.583252037e+00f,
+		2.074722046e+00f, 2.368525584e+00f, 2.368525584e+00f, 2.074722046e+00f, 1.583252037e+00f, 1.039787625e+00f,
+		5.747045529e-01f, 2.566810240e-01f, 8.532997013e-02f, 1.699716142e-02f,
+	},
+};
+
+const arm_rfft_fast_instance_f32 radar_tables_range_rfft = {
+	{ 64, twiddleCoef_64, armBitRevIndexTable64, ARMBITREVINDEXTABLE_64_TABLE_LENGTH },
+	128,
+	twiddleCoef_rfft_128
+};
+
+const arm_cfft_instance_f32* const radar_tables_doppler_cfft = &arm_cfft_sR_f32_len16;
+
+const float32_t radar_tables_range_axis[RADAR_TABLES_NUM_SAMPLES_PER_CHIRP / 2] = {
+	0.000000000e+00f, 3.311748793e-01f, 6.623497587e-01f, 9.935246380e-01f, 1.324699517e+00f, 1.655874397e+00f,
+	1.987049276e+00f, 2.318224155e+00f, 2.649399035e+00f, 2.980573914e+00f, 3.311748793e+00f, 3.642923673e+00f,
+	3.974098552e+00f, 4.305273431e+00f, 4.636448311e+00f, 4.967623190e+00f, 5.298798070e+00f, 5.629972949e+00f,
+	5.961147828e+00f, 6.292322708e+00f, 6.623497587e+00f, 6.954672466e+00f, 7.285847346e+00f, 7.617022225e+00f,
+	7.948197104e+00f, 8.279371984e+00f, 8.610546863e+00f, 8.941721742e+00f, 9.272896622e+00f, 9.604071501e+00f,
+	9.935246380e+00f, 1.026642126e+01f, 1.059759614e+01f, 1.092877102e+01f, 1.125994590e+01f, 1.159112078e+01f,
+	1.192229566e+01f, 1.225347054e+01f, 1.258464542e+01f, 1.291582029e+01f, 1.324699517e+01f, 1.357817005e+01f,
+	1.390934493e+01f, 1.424051981e+01f, 1.457169469e+01f, 1.490286957e+01f, 1.523404445e+01f, 1.556521933e+01f,
+	1.589639421e+01f, 1.622756909e+01f, 1.655874397e+01f, 1.688991885e+01f, 1.722109373e+01f, 1.755226861e+01f,
+	1.788344348e+01f, 1.821461836e+01f, 1.854579324e+01f, 1.887696812e+01f, 1.920814300e+01f, 1.953931788e+01f,
+	1.987049276e+01f, 2.020166764e+01f, 2.053284252e+01f, 2.086401740e+01f,
+};
@@ -0,0 +1,66 @@
+/*
+ * radar_tables.h
+ *
+ * Generated by scripts/generate_radar_tables.py from radar_settings.h
+ * Do not edit: modify radar_settings.h and rebuild instead.
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef PRESENCE_DETECTION_RADAR_TABLES_H_
+#define PRESENCE_DETECTION_RADAR_TABLES_H_
+
+#include "ifx_sensor_dsp.h"
+
+#define RADAR_TABLES_NUM_SAMPLES_PER_CHIRP		(128)
+#define RADAR_TABLES_NUM_CHIRPS_PER_FRAME		(16)
+#define RADAR_TABLES_NUM_RX_ANTENNAS			(1)
+#define RADAR_TABLES_SAMPLE_RATE				(2352941UL)
+#define RADAR_TABLES_START_FREQ_HZ				(61020100000ULL)
+#define RADAR_TABLES_END_FREQ_HZ				(61479904000ULL)
+
+#define RADAR_TABLES_WINDOW_COUNT				(5)
+
+/**
+ * @var radar_tables_range_window
+ * Windows of RADAR_TABLES_NUM_SAMPLES_PER_CHIRP points indexed by window_type_t,
+ * normalized by their coherent gain and multiplied by 1/4096 (ADC scaling)
+ */
+extern const float32_t radar_tables_range_window[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_SAMPLES_PER_CHIRP];
+
+/**
+ * @var radar_tables_range_window_q15
+ * Windows of RADAR_TABLES_NUM_SAMPLES_PER_CHIRP points indexed by window_type_t in Q15 (not normalized, without ADC scaling)
+ */
+extern const q15_t radar_tables_range_window_q15[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_SAMPLES_PER_CHIRP];
+
+/**
+ * @var radar_tables_doppler_window
+ * Windows of RADAR_TABLES_NUM_CHIRPS_PER_FRAME points indexed by window_type_t, normalized by their coherent gain
+ */
+extern const float32_t radar_tables_doppler_window[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_CHIRPS_PER_FRAME];
+
+/**
+ * @var radar_tables_range_rfft
+ * Real FFT plan of RADAR_TABLES_NUM_SAMPLES_PER_CHIRP points
+ */
+extern const arm_rfft_fast_instance_f32 radar_tables_range_rfft;
+
+/**
+ * @var radar_tables_doppler_cfft
+ * Complex FFT plan of RADAR_TABLES_NUM_CHIRPS_PER_FRAME points
+ */
+extern const arm_cfft_instance_f32* const radar_tables_doppler_cfft;
+
+/**
+ * @var radar_tables_range_axis
+ * Distance in meters of each range bin
+ */
+extern const float32_t radar_tables_range_axis[RADAR_TABLES_NUM_SAMPLES_PER_CHIRP / 2];
+
+#endif /* PRESENCE_DETECTION_RADAR_TABLES_H_ */
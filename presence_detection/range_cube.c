@@ -0,0 +1,207 @@
+/*
+ * range_cube.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+
+#include "range_cube.h"
+
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief Float to IEEE half precision (round to nearest)
+ * The FPU of the CM4 could do it (VCVTB) but __fp16 needs -mfp16-format, so it is done by hand
+ */
+static uint16_t float_to_half(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	const uint32_t sign = (bits >> 16) & 0x8000U;
+	const int32_t exponent = (int32_t)((bits >> 23) & 0xFFU) - 127 + 15;
+	uint32_t mantissa = bits & 0x7FFFFFU;
+
+	if (exponent >= 31) return (uint16_t)(sign | 0x7C00U);	// Too big -> infinity
+	if (exponent <= 0)
+	{
+		// Subnormal (or 0)
+		if (exponent < -10) return (uint16_t) sign;
+		mantissa |= 0x800000U;
+		const uint32_t shift = (uint32_t)(14 - exponent);
+		uint32_t half = mantissa >> shift;
+		if ((mantissa >> (shift - 1U)) & 1U) half++;
+		return (uint16_t)(sign | half);
+	}
+
+	uint32_t half = sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+	if (mantissa & 0x1000U) half++;	// A carry into the exponent is still correct
+	return (uint16_t) half;
+}
+
+static float half_to_float(uint16_t half)
+{
+	const uint32_t sign = ((uint32_t)half & 0x8000U) << 16;
+	const uint32_t exponent = ((uint32_t)half >> 10) & 0x1FU;
+	const uint32_t mantissa = (uint32_t)half & 0x3FFU;
+
+	if (exponent == 0)
+	{
+		// Subnormal (or 0): mantissa * 2^-24
+		const float value = (float) mantissa * 5.9604645e-8f;
+		return (sign != 0) ? -value : value;
+	}
+
+	const uint32_t bits = sign | ((exponent == 31U) ? 0x7F800000U : ((exponent + 127U - 15U) << 23)) | (mantissa << 13);
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+size_t range_cube_get_storage_size(range_cube_format_t format, uint16_t chirp_count, uint16_t bin_count)
+{
+	return RANGE_CUBE_STORAGE_SIZE(format, chirp_count, bin_count);
+}
+
+int range_cube_init(range_cube_t* cube, range_cube_format_t format, void* storage, uint16_t chirp_count, uint16_t bin_offset, uint16_t bin_count)
+{
+	if (cube == NULL) return -1;
+	if (storage == NULL) return -2;
+	if ((chirp_count == 0) || (bin_count == 0)) return -3;
+	if (format > RANGE_CUBE_FORMAT_BFP16) return -4;
+
+	cube->format = format;
+	cube->data = storage;
+	cube->chirp_count = chirp_count;
+	cube->bin_offset = bin_offset;
+	cube->bin_count = bin_count;
+	cube->block_scale = NULL;
+	if (format == RANGE_CUBE_FORMAT_BFP16)
+	{
+		cube->block_scale = (float*) &((int16_t*) storage)[2U * (uint32_t)chirp_count * bin_count];
+		for(uint16_t chirp = 0; chirp < chirp_count; ++chirp)
+		{
+			cube->block_scale[chirp] = 0;
+		}
+	}
+
+	return 0;
+}
+
+cfloat32_t* range_cube_get_float_chirp(range_cube_t* cube, uint16_t chirp)
+{
+	if (cube->format != RANGE_CUBE_FORMAT_FLOAT32) return NULL;
+	return &((cfloat32_t*) cube->data)[(uint32_t)chirp * cube->bin_count];
+}
+
+void range_cube_store(range_cube_t* cube, uint16_t chirp, const cfloat32_t* spectrum)
+{
+	range_cube_store_roi(cube, chirp, &spectrum[cube->bin_offset]);
+}
+
+void range_cube_store_roi(range_cube_t* cube, uint16_t chirp, const cfloat32_t* roi)
+{
+	const uint32_t start = (uint32_t)chirp * cube->bin_count;
+	const float* values = (const float*) roi;
+
+	switch(cube->format)
+	{
+		case RANGE_CUBE_FORMAT_FLOAT32:
+			memcpy(&((cfloat32_t*) cube->data)[start], roi, cube->bin_count * sizeof(cfloat32_t));
+			break;
+
+		case RANGE_CUBE_FORMAT_FLOAT16:
+		{
+			uint16_t* dst = &((uint16_t*) cube->data)[2U * start];
+			for(uint32_t i = 0; i < 2U * cube->bin_count; ++i)
+			{
+				dst[i] = float_to_half(values[i]);
+			}
+			break;
+		}
+
+		case RANGE_CUBE_FORMAT_BFP16:
+		{
+			// Common exponent of the chirp: the largest component uses the complete int16 range
+			float max = 0;
+			for(uint32_t i = 0; i < 2U * cube->bin_count; ++i)
+			{
+				const float abs_value = fabsf(values[i]);
+				if (abs_value > max) max = abs_value;
+			}
+
+			int exponent = 0;
+			if (max > 0) frexpf(max, &exponent);	// max = m * 2^exponent, m in [0.5, 1[
+			const float scale = ldexpf(1.f, exponent - 15);
+			const float inverse_scale = ldexpf(1.f, 15 - exponent);
+			cube->block_scale[chirp] = scale;
+
+			int16_t* dst = &((int16_t*) cube->data)[2U * start];
+			for(uint32_t i = 0; i < 2U * cube->bin_count; ++i)
+			{
+				float mantissa = roundf(values[i] * inverse_scale);
+				if (mantissa > 32767.f) mantissa = 32767.f;
+				else if (mantissa < -32768.f) mantissa = -32768.f;
+				dst[i] = (int16_t) mantissa;
+			}
+			break;
+		}
+	}
+}
+
+cfloat32_t range_cube_get(const range_cube_t* cube, uint16_t chirp, uint16_t bin)
+{
+	cfloat32_t value;
+	range_cube_gather_bin(cube, chirp, 1, bin, &value);
+	return value;
+}
+
+void range_cube_gather_bin(const range_cube_t* cube, uint16_t first_chirp, uint16_t chirp_count, uint16_t bin, cfloat32_t* out)
+{
+	uint32_t index = (uint32_t)first_chirp * cube->bin_count + (bin - cube->bin_offset);
+
+	switch(cube->format)
+	{
+		case RANGE_CUBE_FORMAT_FLOAT32:
+		{
+			const cfloat32_t* src = (const cfloat32_t*) cube->data;
+			for(uint16_t i = 0; i < chirp_count; ++i, index += cube->bin_count)
+			{
+				out[i] = src[index];
+			}
+			break;
+		}
+
+		case RANGE_CUBE_FORMAT_FLOAT16:
+		{
+			const uint16_t* src = (const uint16_t*) cube->data;
+			for(uint16_t i = 0; i < chirp_count; ++i, index += cube->bin_count)
+			{
+				CREAL_F32(out[i]) = half_to_float(src[2U * index]);
+				CIMAG_F32(out[i]) = half_to_float(src[2U * index + 1U]);
+			}
+			break;
+		}
+
+		case RANGE_CUBE_FORMAT_BFP16:
+		{
+			const int16_t* src = (const int16_t*) cube->data;
+			for(uint16_t i = 0; i < chirp_count; ++i, index += cube->bin_count)
+			{
+				const float scale = cube->block_scale[first_chirp + i];
+				CREAL_F32(out[i]) = (float) src[2U * index] * scale;
+				CIMAG_F32(out[i]) = (float) src[2U * index + 1U] * scale;
+			}
+			break;
+		}
+	}
+}
@@ -0,0 +1,118 @@
+/*
+ * range_cube.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef PRESENCE_DETECTION_RANGE_CUBE_H_
+#define PRESENCE_DETECTION_RANGE_CUBE_H_
+
+#include "ifx_sensor_dsp.h"
+
+/**
+ * Storage format of the range cube (output of the range FFT, input of the Doppler FFT)
+ */
+typedef enum
+{
+	RANGE_CUBE_FORMAT_FLOAT32 = 0,	/**< Complex float (8 bytes per value) */
+	RANGE_CUBE_FORMAT_FLOAT16,		/**< Complex IEEE half precision (4 bytes per value) */
+	RANGE_CUBE_FORMAT_BFP16,		/**< Complex int16 with one power of 2 scale per chirp (block floating point, 4 bytes per value) */
+} range_cube_format_t;
+
+/**
+ * @def RANGE_CUBE_STORAGE_SIZE
+ * @brief Size in bytes of the storage of a range cube (usable for static buffers)
+ */
+#define RANGE_CUBE_STORAGE_SIZE(format, chirp_count, bin_count) \
+	(((format) == RANGE_CUBE_FORMAT_FLOAT32) ? ((size_t)(chirp_count) * (size_t)(bin_count) * 8U) : \
+	 ((format) == RANGE_CUBE_FORMAT_FLOAT16) ? ((size_t)(chirp_count) * (size_t)(bin_count) * 4U) : \
+	 ((size_t)(chirp_count) * (size_t)(bin_count) * 4U + (size_t)(chirp_count) * 4U))
+
+/**
+ * Range FFT of all the chirps of a frame, stored chirp major: value of chirp c and bin b is at c * bin_count + (b - bin_offset)
+ * The chirps of antenna a start at a * chirps per frame
+ * Only the bins of the region of interest [bin_offset, bin_offset + bin_count[ are stored
+ */
+typedef struct
+{
+	range_cube_format_t format;
+	void* data;				/**< Values (format dependent), allocated by the caller (see range_cube_get_storage_size) */
+	float* block_scale;		/**< RANGE_CUBE_FORMAT_BFP16 only: scale of each chirp (stored after the values) */
+	uint16_t chirp_count;	/**< Number of chirps stored (antenna count * chirps per frame) */
+	uint16_t bin_offset;	/**< First bin stored */
+	uint16_t bin_count;		/**< Number of bins stored per chirp */
+} range_cube_t;
+
+/**
+ * @brief Get the size (in bytes) of the storage needed by a range cube
+ */
+size_t range_cube_get_storage_size(range_cube_format_t format, uint16_t chirp_count, uint16_t bin_count);
+
+/**
+ * @brief Initialize a range cube
+ *
+ * @param [out] cube	Cube to be initialized
+ * @param [in] format	Storage format
+ * @param [in] storage	Memory used to store the values. Size must be range_cube_get_storage_size(format, chirp_count, bin_count)
+ * @param [in] chirp_count	Number of chirps stored
+ * @param [in] bin_offset	First bin stored (region of interest)
+ * @param [in] bin_count	Number of bins stored per chirp
+ *
+ * @retval 0 	Success
+ * @retval != 0	Error occurred
+ */
+int range_cube_init(range_cube_t* cube, range_cube_format_t format, void* storage, uint16_t chirp_count, uint16_t bin_offset, uint16_t bin_count);
+
+/**
+ * @brief Get the direct access to the values of a chirp if the format is RANGE_CUBE_FORMAT_FLOAT32
+ * The first value is the one of bin_offset
+ *
+ * @retval NULL if the values are packed (range_cube_store must be used)
+ */
+cfloat32_t* range_cube_get_float_chirp(range_cube_t* cube, uint16_t chirp);
+
+/**
+ * @brief Store (and pack) the bins of interest of the range FFT of a chirp
+ *
+ * @param [inout] cube	Range cube
+ * @param [in] chirp	Chirp index [0] to [chirp_count - 1]
+ * @param [in] spectrum	Complete range FFT of the chirp (at least bin_offset + bin_count complex values)
+ */
+void range_cube_store(range_cube_t* cube, uint16_t chirp, const cfloat32_t* spectrum);
+
+/**
+ * @brief Store (and pack) the range values of a chirp computed only for the region of interest
+ *
+ * @param [inout] cube	Range cube
+ * @param [in] chirp	Chirp index [0] to [chirp_count - 1]
+ * @param [in] roi	bin_count complex values (first one is the value of bin_offset)
+ */
+void range_cube_store_roi(range_cube_t* cube, uint16_t chirp, const cfloat32_t* roi);
+
+/**
+ * @brief Get one value of the cube (expanded to float)
+ * @param [in] bin	Bin index (absolute, between bin_offset and bin_offset + bin_count - 1)
+ */
+cfloat32_t range_cube_get(const range_cube_t* cube, uint16_t chirp, uint16_t bin);
+
+/**
+ * @brief Gather (and expand to float) the values of a bin over consecutive chirps (slow time)
+ * Typically used as input of the Doppler FFT
+ *
+ * @param [in] cube	Range cube
+ * @param [in] first_chirp	Index of the first chirp
+ * @param [in] chirp_count	Number of chirps to be gathered
+ * @param [in] bin	Bin index (absolute, between bin_offset and bin_offset + bin_count - 1)
+ * @param [out] out	Destination, size must be at least chirp_count
+ */
+void range_cube_gather_bin(const range_cube_t* cube, uint16_t first_chirp, uint16_t chirp_count, uint16_t bin, cfloat32_t* out);
+
+#endif /* PRESENCE_DETECTION_RANGE_CUBE_H_ */
@@ -14,6 +14,83 @@
 
 
 #include "range_fft.h"
+#include "fft_plan_cache.h"
+
+#include <string.h>
+
+/**
+ * @def PRESENCE_DETECTION_STATIC_CONFIG
+ * @brief If defined, the antenna count, samples per chirp and chirps per frame are the constants of radar_settings.h
+ * (through radar_tables.h): the loops of this file are compiled with constant trip counts. Other lengths are rejected.
+ */
+#ifdef PRESENCE_DETECTION_STATIC_CONFIG
+#include "radar_tables.h"
+#define STATIC_LENGTH(length, constant)		do { if ((length) != (constant)) return IFX_SENSOR_DSP_ARGUMENT_ERROR; (length) = (constant); } while (0)
+#else
+#define STATIC_LENGTH(length, constant)		do { } while (0)
+#endif
+
+/**
+ * @brief Unpack and window one chirp of one antenna
+ */
+static inline void range_fft_prepare_chirp(const uint16_t* frame,
+		float* adc_samples,
+		bool mean_removal,
+		const float32_t* win,
+		uint8_t antenna_count,
+		uint8_t antenna_idx,
+		uint32_t chirp_idx,
+		uint16_t num_samples_per_chirp)
+{
+	// The ADC scaling is part of the window
+	const float32_t scale = (win != NULL) ? 1.f : (1.f / 4096.f);
+
+	// The data are interleaved, first need to extract them from the buffer
+	uint16_t start_index = chirp_idx * antenna_count * num_samples_per_chirp;
+
+	for(uint16_t sample_idx = 0; sample_idx < num_samples_per_chirp; ++sample_idx)
+	{
+		uint16_t index = start_index + sample_idx * antenna_count + antenna_idx;
+		adc_samples[sample_idx] = ((float)frame[index]) * scale; // Copy (scaling between 0 and 1 is done here or by the window)
+	}
+
+	if (mean_removal)
+	{
+		ifx_mean_removal_f32(adc_samples, num_samples_per_chirp);
+	}
+
+	if (win != NULL)
+	{
+		arm_mult_f32(adc_samples, win, adc_samples, num_samples_per_chirp);
+	}
+}
+
+/**
+ * @brief Unpack, window and transform one chirp of one antenna
+ * If the plan is longer than num_samples_per_chirp, the chirp is zero padded (adc_samples must hold fftLenRFFT values)
+ */
+static inline void range_fft_chirp(const uint16_t* frame,
+		cfloat32_t* out,
+		float* adc_samples,
+		bool mean_removal,
+		const float32_t* win,
+		const arm_rfft_fast_instance_f32* rfft,
+		uint8_t antenna_count,
+		uint8_t antenna_idx,
+		uint32_t chirp_idx,
+		uint16_t num_samples_per_chirp)
+{
+	range_fft_prepare_chirp(frame, adc_samples, mean_removal, win, antenna_count, antenna_idx, chirp_idx, num_samples_per_chirp);
+
+	// arm_rfft_fast_f32 uses its input as scratch: the padding must be cleared for each chirp
+	if (rfft->fftLenRFFT > num_samples_per_chirp)
+	{
+		memset(&adc_samples[num_samples_per_chirp], 0, (rfft->fftLenRFFT - num_samples_per_chirp) * sizeof(float));
+	}
+
+	arm_rfft_fast_f32(rfft, adc_samples, (float32_t*)out, 0);
+	CIMAG_F32(out[0]) = 0.0f;
+}
 
 /**
  * @brief Perform range FFT on the samples contained inside the frame buffer
@@ -35,6 +112,9 @@
  * @param [in] mean_removal	If true, mean will be subtracted from the time buffer
  *
  * @param [in] win		Window to be applied on time buffer before computing FFT
+ * 						The window must include the ADC scaling (1/4096). If NULL, the samples are scaled by 1/4096
+ *
+ * @param [in] rfft		Real FFT plan (num_samples_per_chirp points). If NULL, a plan is initialized on first call
  *
  * @param [in] antenna_count	Number of antennas
  *
@@ -50,21 +130,22 @@ int range_fft_do(uint16_t* frame,
 		float* adc_samples,
 		bool mean_removal,
 		const float32_t* win,
+		const arm_rfft_fast_instance_f32* rfft,
 		uint8_t antenna_count,
 		uint16_t num_samples_per_chirp,
 		uint16_t num_chirps_per_frame)
 {
     if (frame == NULL) return -1;
     if (range == NULL) return -2;
+    STATIC_LENGTH(antenna_count, RADAR_TABLES_NUM_RX_ANTENNAS);
+    STATIC_LENGTH(num_samples_per_chirp, RADAR_TABLES_NUM_SAMPLES_PER_CHIRP);
+    STATIC_LENGTH(num_chirps_per_frame, RADAR_TABLES_NUM_CHIRPS_PER_FRAME);
 
-    // Init FFT algorithm
-    static arm_rfft_fast_instance_f32 rfft = { 0 };
-    if (rfft.fftLenRFFT != num_samples_per_chirp)
+    // Get the FFT plan from the shared cache (only if no plan is given)
+    if (rfft == NULL)
     {
-        if (arm_rfft_fast_init_f32(&rfft, num_samples_per_chirp) != ARM_MATH_SUCCESS)
-        {
-            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
-        }
+        rfft = fft_plan_cache_get_rfft_f32(num_samples_per_chirp);
+        if (rfft == NULL) return IFX_SENSOR_DSP_ARGUMENT_ERROR;
     }
 
     // For each antenna
@@ -72,6 +153,139 @@ int range_fft_do(uint16_t* frame,
     {
     	// For each chirp
     	for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+		{
+    		range_fft_chirp(frame, range, adc_samples, mean_removal, win, rfft, antenna_count, antenna_idx, chirp_idx, num_samples_per_chirp);
+			range += (num_samples_per_chirp / 2U);
+		}
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+int range_fft_do_cube(uint16_t* frame,
+		range_cube_t* cube,
+		float* adc_samples,
+		cfloat32_t* spectrum,
+		bool mean_removal,
+		const float32_t* win,
+		const arm_rfft_fast_instance_f32* rfft,
+		uint8_t antenna_count,
+		uint16_t num_samples_per_chirp,
+		uint16_t num_chirps_per_frame,
+		uint16_t first_chirp,
+		uint16_t chirp_count)
+{
+    if (frame == NULL) return -1;
+    if (cube == NULL) return -2;
+    if (rfft == NULL) return -3;
+    if ((first_chirp + chirp_count) > num_chirps_per_frame) return -4;
+    STATIC_LENGTH(antenna_count, RADAR_TABLES_NUM_RX_ANTENNAS);
+    STATIC_LENGTH(num_samples_per_chirp, RADAR_TABLES_NUM_SAMPLES_PER_CHIRP);
+    STATIC_LENGTH(num_chirps_per_frame, RADAR_TABLES_NUM_CHIRPS_PER_FRAME);
+
+    // The FFT can only write directly inside a float cube storing the complete (padded) spectrum
+    const bool direct = (cube->format == RANGE_CUBE_FORMAT_FLOAT32) && (cube->bin_offset == 0) && (cube->bin_count == rfft->fftLenRFFT / 2U);
+    if (!direct && (spectrum == NULL)) return -5;
+
+    for(uint8_t antenna_idx = 0; antenna_idx < antenna_count; ++antenna_idx)
+    {
+    	for (uint32_t chirp_idx = 0; chirp_idx < chirp_count; ++chirp_idx)
+		{
+    		const uint16_t cube_chirp = antenna_idx * num_chirps_per_frame + first_chirp + chirp_idx;
+
+    		if (direct)
+    		{
+    			range_fft_chirp(frame, range_cube_get_float_chirp(cube, cube_chirp), adc_samples, mean_removal, win, rfft, antenna_count, antenna_idx, chirp_idx, num_samples_per_chirp);
+    		}
+    		else
+    		{
+    			// Only the region of interest is copied out (and packed)
+    			range_fft_chirp(frame, spectrum, adc_samples, mean_removal, win, rfft, antenna_count, antenna_idx, chirp_idx, num_samples_per_chirp);
+    			range_cube_store(cube, cube_chirp, spectrum);
+    		}
+		}
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+int range_zoom_do_cube(uint16_t* frame,
+		range_cube_t* cube,
+		float* adc_samples,
+		cfloat32_t* spectrum,
+		bool mean_removal,
+		const float32_t* win,
+		const range_zoom_t* zoom,
+		uint8_t antenna_count,
+		uint16_t num_samples_per_chirp,
+		uint16_t num_chirps_per_frame,
+		uint16_t first_chirp,
+		uint16_t chirp_count)
+{
+    if (frame == NULL) return -1;
+    if (cube == NULL) return -2;
+    if ((zoom == NULL) || (zoom->point_count != cube->bin_count) || (zoom->num_samples != num_samples_per_chirp)) return -3;
+    if ((first_chirp + chirp_count) > num_chirps_per_frame) return -4;
+    if ((cube->format != RANGE_CUBE_FORMAT_FLOAT32) && (spectrum == NULL)) return -5;
+    STATIC_LENGTH(antenna_count, RADAR_TABLES_NUM_RX_ANTENNAS);
+    STATIC_LENGTH(num_samples_per_chirp, RADAR_TABLES_NUM_SAMPLES_PER_CHIRP);
+    STATIC_LENGTH(num_chirps_per_frame, RADAR_TABLES_NUM_CHIRPS_PER_FRAME);
+
+    for(uint8_t antenna_idx = 0; antenna_idx < antenna_count; ++antenna_idx)
+    {
+    	for (uint32_t chirp_idx = 0; chirp_idx < chirp_count; ++chirp_idx)
+		{
+    		const uint16_t cube_chirp = antenna_idx * num_chirps_per_frame + first_chirp + chirp_idx;
+
+    		range_fft_prepare_chirp(frame, adc_samples, mean_removal, win, antenna_count, antenna_idx, chirp_idx, num_samples_per_chirp);
+
+    		// Float cube: the zoom DFT writes directly inside the cube
+    		cfloat32_t* out = range_cube_get_float_chirp(cube, cube_chirp);
+    		range_zoom_do(zoom, adc_samples, (out != NULL) ? out : spectrum);
+    		if (out == NULL)
+    		{
+    			range_cube_store_roi(cube, cube_chirp, spectrum);
+    		}
+		}
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+int range_fft_do_q15(uint16_t* frame,
+		q15_t* range,
+		q15_t* scratch,
+		bool mean_removal,
+		const q15_t* win,
+		const arm_rfft_instance_q15* rfft,
+		uint8_t antenna_count,
+		uint16_t num_samples_per_chirp,
+		uint16_t num_chirps_per_frame,
+		uint16_t first_chirp,
+		uint16_t chirp_count,
+		uint16_t bin_start,
+		uint16_t bin_count)
+{
+    if (frame == NULL) return -1;
+    if (range == NULL) return -2;
+    if ((scratch == NULL) || (rfft == NULL)) return -3;
+    if ((bin_start + bin_count) > (num_samples_per_chirp / 2U)) return -4;
+    if ((first_chirp + chirp_count) > num_chirps_per_frame) return -5;
+    STATIC_LENGTH(antenna_count, RADAR_TABLES_NUM_RX_ANTENNAS);
+    STATIC_LENGTH(num_samples_per_chirp, RADAR_TABLES_NUM_SAMPLES_PER_CHIRP);
+    STATIC_LENGTH(num_chirps_per_frame, RADAR_TABLES_NUM_CHIRPS_PER_FRAME);
+
+    q15_t* time = scratch;
+    q15_t* spectrum = &scratch[num_samples_per_chirp];	// arm_rfft_q15 writes the complete spectrum (2 * num_samples_per_chirp)
+
+    // For each antenna
+    for(uint8_t antenna_idx = 0; antenna_idx < antenna_count; ++antenna_idx)
+    {
+    	// Chirps of the antenna inside the range buffer
+    	q15_t* out = &range[((uint32_t)antenna_idx * num_chirps_per_frame + first_chirp) * bin_count * 2U];
+
+    	// For each chirp
+    	for (uint32_t chirp_idx = 0; chirp_idx < chirp_count; ++chirp_idx)
 		{
     		// The data are interleaved, first need to extract them from the buffer
     		uint16_t start_index = chirp_idx * antenna_count * num_samples_per_chirp;
@@ -79,23 +293,28 @@ int range_fft_do(uint16_t* frame,
     		for(uint16_t sample_idx = 0; sample_idx < num_samples_per_chirp; ++sample_idx)
     		{
     			uint16_t index = start_index + sample_idx * antenna_count + antenna_idx;
-    			adc_samples[sample_idx] = ((float)frame[index]) / 4096.f; // Copy and directly scale between 0 and 1
+    			time[sample_idx] = (q15_t)(frame[index] << 3); // 12 bits -> Q15 (sample / 4096)
     		}
 
 			if (mean_removal)
 			{
-				ifx_mean_removal_f32(adc_samples, num_samples_per_chirp);
+				q15_t mean;
+				arm_mean_q15(time, num_samples_per_chirp, &mean);
+				arm_offset_q15(time, -mean, time, num_samples_per_chirp);
 			}
 
 			if (win != NULL)
 			{
-				arm_mult_f32(adc_samples, win, adc_samples, num_samples_per_chirp);
+				arm_mult_q15(time, win, time, num_samples_per_chirp);
 			}
 
-			arm_rfft_fast_f32(&rfft, adc_samples, (float32_t*)range, 0);
-			CIMAG_F32(range[0]) = 0.0f;
+			arm_rfft_q15(rfft, time, spectrum);
 
-			range += (num_samples_per_chirp / 2U);
+			// Keep the bins of interest
+			spectrum[1] = 0;
+			memcpy(out, &spectrum[2U * bin_start], bin_count * 2U * sizeof(q15_t));
+
+			out += (bin_count * 2U);
 		}
     }
 
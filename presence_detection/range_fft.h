@@ -16,6 +16,8 @@
 #define PRESENCE_DETECTION_RANGE_FFT_H_
 
 #include "ifx_sensor_dsp.h"
+#include "range_cube.h"
+#include "range_zoom.h"
 
 /**
  * @brief Perform range FFT on the samples contained inside the frame buffer
@@ -37,6 +39,9 @@
  * @param [in] mean_removal	If true, mean will be subtracted from the time buffer
  *
  * @param [in] win		Window to be applied on time buffer before computing FFT
+ * 						The window must include the ADC scaling (1/4096). If NULL, the samples are scaled by 1/4096
+ *
+ * @param [in] rfft		Real FFT plan (num_samples_per_chirp points). If NULL, the plan is taken from the plan cache
  *
  * @param [in] antenna_count	Number of antennas
  *
@@ -52,8 +57,141 @@ int range_fft_do(uint16_t* frame,
 		float* adc_samples,
 		bool mean_removal,
 		const float32_t* win,
+		const arm_rfft_fast_instance_f32* rfft,
 		uint8_t antenna_count,
 		uint16_t num_samples_per_chirp,
 		uint16_t num_chirps_per_frame);
 
+/**
+ * @brief Version of range_fft_do storing the result inside a range cube (packed formats supported)
+ *
+ * @param [inout] cube	Range cube of antenna_count * num_chirps_per_frame chirps. Only the bins of interest of the cube are stored
+ *
+ * @param [in] adc_samples	Time buffer of rfft->fftLenRFFT values
+ *
+ * @param [in] spectrum	Buffer of rfft->fftLenRFFT / 2 complex values receiving the FFT of one chirp before copy and packing
+ * 						(not used if the cube is RANGE_CUBE_FORMAT_FLOAT32 and stores all the bins, can be NULL)
+ *
+ * @param [in] rfft		Real FFT plan. If longer than num_samples_per_chirp, the chirps are zero padded
+ * 						(range grid of rfft->fftLenRFFT / 2 bins, finer than the native one)
+ *
+ * @param [in] first_chirp	Index inside the frame (and the cube) of the first chirp contained in frame
+ *
+ * @param [in] chirp_count	Number of chirps contained in frame (num_chirps_per_frame -> complete frame)
+ * 							Streaming: frame can hold a part of the frame only, the chirps are stored from first_chirp
+ *
+ * Other parameters: same as range_fft_do
+ *
+ * @retval 0 	Success
+ * @retval -1	Invalid frame
+ * @retval -2	Invalid cube
+ * @retval -3	Invalid rfft
+ * @retval -4	Chirps beyond num_chirps_per_frame
+ * @retval -5	Invalid spectrum (required by the packed formats and the regions of interest)
+ */
+int range_fft_do_cube(uint16_t* frame,
+		range_cube_t* cube,
+		float* adc_samples,
+		cfloat32_t* spectrum,
+		bool mean_removal,
+		const float32_t* win,
+		const arm_rfft_fast_instance_f32* rfft,
+		uint8_t antenna_count,
+		uint16_t num_samples_per_chirp,
+		uint16_t num_chirps_per_frame,
+		uint16_t first_chirp,
+		uint16_t chirp_count);
+
+/**
+ * @brief Version of range_fft_do_cube computing only the region of interest with a zoom DFT
+ * (finer spacing than the FFT grid, cost proportional to the number of points)
+ *
+ * @param [inout] cube	Range cube, its bin_count must be the point_count of zoom
+ *
+ * @param [in] spectrum	Buffer of zoom->point_count complex values receiving the values of one chirp before packing
+ * 						(not used if the cube is RANGE_CUBE_FORMAT_FLOAT32, can be NULL)
+ *
+ * @param [in] zoom		Zoom DFT (frequencies of the region of interest)
+ *
+ * Other parameters: same as range_fft_do_cube
+ *
+ * @retval 0 	Success
+ * @retval -1	Invalid frame
+ * @retval -2	Invalid cube
+ * @retval -3	Invalid zoom (NULL, point_count different from the bin_count of the cube or other num_samples_per_chirp)
+ * @retval -4	Chirps beyond num_chirps_per_frame
+ * @retval -5	Invalid spectrum (required by the packed formats)
+ */
+int range_zoom_do_cube(uint16_t* frame,
+		range_cube_t* cube,
+		float* adc_samples,
+		cfloat32_t* spectrum,
+		bool mean_removal,
+		const float32_t* win,
+		const range_zoom_t* zoom,
+		uint8_t antenna_count,
+		uint16_t num_samples_per_chirp,
+		uint16_t num_chirps_per_frame,
+		uint16_t first_chirp,
+		uint16_t chirp_count);
+
+/**
+ * @brief Fixed-point version of range_fft_do (Q15)
+ *
+ * Scaling at each stage:
+ * - ADC sample (12 bits, 0 to 4095) << 3 -> Q15, same scale as the float path (sample / 4096)
+ * - Mean removal -> [-1, 1[, no saturation possible
+ * - Window (Q15, without the ADC scaling) -> |x| < 1
+ * - arm_rfft_q15 scales its output down by num_samples_per_chirp / 2 (CMSIS: 7.9 format for 128 points)
+ *   -> range_q15 = range_float / (num_samples_per_chirp / 2). The coherent gain of the window keeps the result below 1
+ *
+ * @param [in] frame	Same as range_fft_do
+ *
+ * @param [out] range	Contains the bins of interest of the range FFT (interleaved real, imaginary)
+ * 						Size of this buffer is antenna_count * num_chirps_per_frame * bin_count * 2 * sizeof(q15_t)
+ * 						range[0], range[1] -> antenna 0, chirp 0, range index bin_start
+ *
+ * @param [in] scratch	Buffer of 3 * num_samples_per_chirp q15_t (input and output of the real FFT)
+ *
+ * @param [in] mean_removal	If true, mean will be subtracted from the time buffer
+ *
+ * @param [in] win		Q15 window (without ADC scaling) to be applied on time buffer before computing FFT (can be NULL)
+ *
+ * @param [in] rfft		Q15 real FFT plan (num_samples_per_chirp points, forward, bit reversal)
+ *
+ * @param [in] antenna_count	Number of antennas
+ *
+ * @param [in] num_samples_per_chirp	Number of ADC samples per chirp
+ *
+ * @param [in] num_chirps_per_frame		Number of chirps per frame
+ *
+ * @param [in] first_chirp	Same as range_fft_do_cube
+ *
+ * @param [in] chirp_count	Same as range_fft_do_cube
+ *
+ * @param [in] bin_start	First bin stored inside range (region of interest)
+ *
+ * @param [in] bin_count	Number of bins stored per chirp
+ *
+ * @retval 0 	Success
+ * @retval -1	Invalid frame
+ * @retval -2	Invalid range
+ * @retval -3	Invalid scratch or rfft
+ * @retval -4	Bins of interest beyond num_samples_per_chirp / 2
+ * @retval -5	Chirps beyond num_chirps_per_frame
+ */
+int range_fft_do_q15(uint16_t* frame,
+		q15_t* range,
+		q15_t* scratch,
+		bool mean_removal,
+		const q15_t* win,
+		const arm_rfft_instance_q15* rfft,
+		uint8_t antenna_count,
+		uint16_t num_samples_per_chirp,
+		uint16_t num_chirps_per_frame,
+		uint16_t first_chirp,
+		uint16_t chirp_count,
+		uint16_t bin_start,
+		uint16_t bin_count);
+
 #endif /* PRESENCE_DETECTION_RANGE_FFT_H_ */
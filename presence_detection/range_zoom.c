@@ -0,0 +1,77 @@
+/*
+ * range_zoom.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+
+#include "range_zoom.h"
+
+#include <math.h>
+
+static const float TWO_PI = 6.28318530718f;
+
+size_t range_zoom_get_storage_size(uint16_t point_count)
+{
+	return (size_t)point_count * (sizeof(float) + 2 * sizeof(cfloat32_t));
+}
+
+int range_zoom_init(range_zoom_t* zoom, void* storage, uint16_t num_samples, float first_bin, float bin_step, uint16_t point_count)
+{
+	if (zoom == NULL) return -1;
+	if (storage == NULL) return -2;
+	if ((num_samples < 2) || (point_count == 0) || (bin_step <= 0)) return -3;
+
+	zoom->num_samples = num_samples;
+	zoom->point_count = point_count;
+	zoom->rotation = (cfloat32_t*) storage;
+	zoom->correction = &zoom->rotation[point_count];
+	zoom->coeff = (float*) &zoom->correction[point_count];
+
+	for(uint16_t k = 0; k < point_count; ++k)
+	{
+		const float bin = first_bin + (float) k * bin_step;
+		const float w = TWO_PI * bin / (float) num_samples;
+		zoom->coeff[k] = 2.f * cosf(w);
+		CREAL_F32(zoom->rotation[k]) = cosf(w);
+		CIMAG_F32(zoom->rotation[k]) = -sinf(w);
+
+		// Reduce the phase before the conversion (w * (num_samples - 1) can be large)
+		const float turns = fmodf(bin * (float)(num_samples - 1), (float) num_samples) / (float) num_samples;
+		CREAL_F32(zoom->correction[k]) = cosf(TWO_PI * turns);
+		CIMAG_F32(zoom->correction[k]) = -sinf(TWO_PI * turns);
+	}
+
+	return 0;
+}
+
+void range_zoom_do(const range_zoom_t* zoom, const float* time, cfloat32_t* out)
+{
+	for(uint16_t k = 0; k < zoom->point_count; ++k)
+	{
+		const float coeff = zoom->coeff[k];
+		float s1 = 0;
+		float s2 = 0;
+		for(uint16_t n = 0; n < zoom->num_samples; ++n)
+		{
+			const float s0 = time[n] + coeff * s1 - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+
+		// y = s[N - 1] - exp(-jw) * s[N - 2], X(w) = exp(-jw(N - 1)) * y
+		const float y_real = s1 - CREAL_F32(zoom->rotation[k]) * s2;
+		const float y_imag = -CIMAG_F32(zoom->rotation[k]) * s2;
+		const cfloat32_t c = zoom->correction[k];
+		CREAL_F32(out[k]) = CREAL_F32(c) * y_real - CIMAG_F32(c) * y_imag;
+		CIMAG_F32(out[k]) = CREAL_F32(c) * y_imag + CIMAG_F32(c) * y_real;
+	}
+}
@@ -0,0 +1,67 @@
+/*
+ * range_zoom.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef PRESENCE_DETECTION_RANGE_ZOOM_H_
+#define PRESENCE_DETECTION_RANGE_ZOOM_H_
+
+#include "ifx_sensor_dsp.h"
+
+/**
+ * Zoom DFT: spectrum of a real chirp evaluated at point_count frequencies
+ * first_bin, first_bin + bin_step, ... (in bins of the num_samples points FFT, bin_step can be < 1)
+ * Each point is computed with a generalized Goertzel filter (1 multiplication per sample)
+ * -> cost is num_samples * point_count, proportional to the region of interest and not to an equivalent zero-padded FFT
+ * For an integer bin, the result is the same as the one of the FFT
+ */
+typedef struct
+{
+	uint16_t num_samples;	/**< Length of the time signal */
+	uint16_t point_count;	/**< Number of frequencies computed */
+	float* coeff;			/**< 2 * cos(w) of each frequency */
+	cfloat32_t* rotation;	/**< exp(-j * w) of each frequency */
+	cfloat32_t* correction;	/**< exp(-j * w * (num_samples - 1)) of each frequency */
+} range_zoom_t;
+
+/**
+ * @brief Get the size (in bytes) of the storage needed by a zoom DFT
+ *
+ * @param [in] point_count	Number of frequencies computed
+ */
+size_t range_zoom_get_storage_size(uint16_t point_count);
+
+/**
+ * @brief Initialize a zoom DFT (compute the coefficients)
+ *
+ * @param [out] zoom	Zoom DFT to be initialized
+ * @param [in] storage	Memory used to store the coefficients. Size must be range_zoom_get_storage_size(point_count)
+ * @param [in] num_samples	Length of the time signal
+ * @param [in] first_bin	First frequency (in bins of the num_samples points FFT)
+ * @param [in] bin_step	Spacing of the frequencies (in bins of the num_samples points FFT)
+ * @param [in] point_count	Number of frequencies computed
+ *
+ * @retval 0 	Success
+ * @retval != 0	Error occurred
+ */
+int range_zoom_init(range_zoom_t* zoom, void* storage, uint16_t num_samples, float first_bin, float bin_step, uint16_t point_count);
+
+/**
+ * @brief Compute the spectrum of a (windowed) chirp
+ *
+ * @param [in] zoom	Zoom DFT
+ * @param [in] time	num_samples real samples
+ * @param [out] out	point_count complex values
+ */
+void range_zoom_do(const range_zoom_t* zoom, const float* time, cfloat32_t* out);
+
+#endif /* PRESENCE_DETECTION_RANGE_ZOOM_H_ */
@@ -0,0 +1,82 @@
+/*
+ * slow_time_buffer.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "slow_time_buffer.h"
+
+#include <string.h>
+
+size_t slow_time_buffer_get_storage_size(uint16_t bin_count, uint16_t history_len)
+{
+	return (size_t)bin_count * (size_t)history_len * sizeof(cfloat32_t);
+}
+
+int slow_time_buffer_init(slow_time_buffer_t* buffer, cfloat32_t* storage, uint16_t bin_count, uint16_t history_len)
+{
+	if (buffer == NULL) return -1;
+	if (storage == NULL) return -2;
+	if ((bin_count == 0) || (history_len == 0)) return -3;
+
+	buffer->data = storage;
+	buffer->bin_count = bin_count;
+	buffer->history_len = history_len;
+	slow_time_buffer_reset(buffer);
+
+	return 0;
+}
+
+void slow_time_buffer_reset(slow_time_buffer_t* buffer)
+{
+	buffer->write_idx = 0;
+	buffer->count = 0;
+}
+
+void slow_time_buffer_set(slow_time_buffer_t* buffer, uint16_t bin, cfloat32_t sample)
+{
+	buffer->data[(uint32_t)bin * buffer->history_len + buffer->write_idx] = sample;
+}
+
+void slow_time_buffer_advance(slow_time_buffer_t* buffer)
+{
+	buffer->write_idx++;
+	if (buffer->write_idx >= buffer->history_len) buffer->write_idx = 0;
+	if (buffer->count < buffer->history_len) buffer->count++;
+}
+
+cfloat32_t slow_time_buffer_get(const slow_time_buffer_t* buffer, uint16_t bin, uint16_t age)
+{
+	cfloat32_t retval = { 0 };
+	if (age >= buffer->count) return retval;
+
+	// write_idx points to the next (not yet valid) slot
+	uint16_t idx = (buffer->write_idx >= age + 1) ? (buffer->write_idx - age - 1) : (buffer->write_idx + buffer->history_len - age - 1);
+	return buffer->data[(uint32_t)bin * buffer->history_len + idx];
+}
+
+uint16_t slow_time_buffer_copy_history(const slow_time_buffer_t* buffer, uint16_t bin, cfloat32_t* out, uint16_t len)
+{
+	if (len > buffer->count) len = buffer->count;
+
+	const cfloat32_t* bin_data = &buffer->data[(uint32_t)bin * buffer->history_len];
+
+	// Oldest requested sample
+	uint16_t idx = (buffer->write_idx >= len) ? (buffer->write_idx - len) : (buffer->write_idx + buffer->history_len - len);
+
+	// At most 2 contiguous segments
+	uint16_t first_len = buffer->history_len - idx;
+	if (first_len > len) first_len = len;
+	memcpy(out, &bin_data[idx], first_len * sizeof(cfloat32_t));
+	memcpy(&out[first_len], bin_data, (len - first_len) * sizeof(cfloat32_t));
+
+	return len;
+}
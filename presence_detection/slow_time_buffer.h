@@ -0,0 +1,103 @@
+/*
+ * slow_time_buffer.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef PRESENCE_DETECTION_SLOW_TIME_BUFFER_H_
+#define PRESENCE_DETECTION_SLOW_TIME_BUFFER_H_
+
+#include "ifx_sensor_dsp.h"
+
+/**
+ * Ring buffer storing one complex sample per frame and per range bin (slow-time signal)
+ * The storage is bin major: data[bin * history_len + sample index]
+ * Memory only depends on bin_count * history_len (not on the frame size)
+ */
+typedef struct
+{
+	cfloat32_t* data;		/**< Storage, allocated by the caller (see slow_time_buffer_get_storage_size) */
+	uint16_t bin_count;		/**< Number of bins stored */
+	uint16_t history_len;	/**< Number of frames stored per bin */
+	uint16_t write_idx;		/**< Index where the sample of the next frame will be written */
+	uint16_t count;			/**< Number of valid frames (saturates at history_len) */
+} slow_time_buffer_t;
+
+/**
+ * @brief Get the size (in bytes) of the storage needed by a slow-time buffer
+ *
+ * @param [in] bin_count	Number of bins to be stored
+ * @param [in] history_len	Number of frames to be stored per bin
+ *
+ * @retval Size in bytes
+ */
+size_t slow_time_buffer_get_storage_size(uint16_t bin_count, uint16_t history_len);
+
+/**
+ * @brief Initialize the slow-time buffer
+ *
+ * @param [out] buffer	Buffer to be initialized
+ * @param [in] storage	Memory used to store the samples. Size must be slow_time_buffer_get_storage_size(bin_count, history_len)
+ * @param [in] bin_count	Number of bins to be stored
+ * @param [in] history_len	Number of frames to be stored per bin
+ *
+ * @retval 0 	Success
+ * @retval != 0	Error occurred
+ */
+int slow_time_buffer_init(slow_time_buffer_t* buffer, cfloat32_t* storage, uint16_t bin_count, uint16_t history_len);
+
+/**
+ * @brief Discard the complete history (storage is kept)
+ */
+void slow_time_buffer_reset(slow_time_buffer_t* buffer);
+
+/**
+ * @brief Store the sample of the current frame for the given bin
+ * Once the samples of all bins have been set, slow_time_buffer_advance must be called
+ *
+ * @param [inout] buffer	Slow-time buffer
+ * @param [in] bin	Bin index (relative to the first stored bin) [0] to [bin_count - 1]
+ * @param [in] sample	Slow-time sample of the bin for the current frame
+ */
+void slow_time_buffer_set(slow_time_buffer_t* buffer, uint16_t bin, cfloat32_t sample);
+
+/**
+ * @brief Close the current frame (the samples set are now accessible with age 0)
+ */
+void slow_time_buffer_advance(slow_time_buffer_t* buffer);
+
+/**
+ * @brief Get the sample of a bin
+ * The sample leaving the window at the next advance is at age (history_len - 1).
+ * This enables sliding DFT or phase tracking to be updated incrementally.
+ *
+ * @param [in] buffer	Slow-time buffer
+ * @param [in] bin	Bin index (relative to the first stored bin)
+ * @param [in] age	0 -> last frame, 1 -> frame before...
+ *
+ * @retval Sample (0 if age is out of the stored history)
+ */
+cfloat32_t slow_time_buffer_get(const slow_time_buffer_t* buffer, uint16_t bin, uint16_t age);
+
+/**
+ * @brief Copy the history of a bin in chronological order (oldest first)
+ * Typically used as input of a long window (slow-time) FFT
+ *
+ * @param [in] buffer	Slow-time buffer
+ * @param [in] bin	Bin index (relative to the first stored bin)
+ * @param [out] out	Destination, size must be at least len
+ * @param [in] len	Number of frames to be copied (the newest len frames are copied)
+ *
+ * @retval Number of frames copied (might be less than len if the history is not filled yet)
+ */
+uint16_t slow_time_buffer_copy_history(const slow_time_buffer_t* buffer, uint16_t bin, cfloat32_t* out, uint16_t len);
+
+#endif /* PRESENCE_DETECTION_SLOW_TIME_BUFFER_H_ */
@@ -0,0 +1,167 @@
+/*
+ * vital_signs.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "vital_signs.h"
+
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief Compute the coefficients of a 2nd order Butterworth section (RBJ cookbook)
+ * Coefficients are stored in the CMSIS order {b0, b1, b2, a1, a2} (a1 and a2 negated)
+ */
+static void design_biquad(float32_t* coeffs, float cutoff, float frame_rate, bool high_pass)
+{
+	const float w0 = 2.f * PI * cutoff / frame_rate;
+	const float cos_w0 = cosf(w0);
+	const float alpha = sinf(w0) / (2.f * 0.70710678f);
+	const float a0 = 1.f + alpha;
+
+	if (high_pass)
+	{
+		coeffs[0] = ((1.f + cos_w0) / 2.f) / a0;
+		coeffs[1] = -(1.f + cos_w0) / a0;
+	}
+	else
+	{
+		coeffs[0] = ((1.f - cos_w0) / 2.f) / a0;
+		coeffs[1] = (1.f - cos_w0) / a0;
+	}
+	coeffs[2] = coeffs[0];
+	coeffs[3] = (2.f * cos_w0) / a0;
+	coeffs[4] = -(1.f - alpha) / a0;
+}
+
+int vital_signs_init(vital_signs_t* vs, float frame_rate)
+{
+	// Keep the band well below Nyquist
+	if (VITAL_SIGNS_MAX_FREQ_HZ > 0.4f * frame_rate) return -1;
+
+	design_biquad(&vs->coeffs[0], VITAL_SIGNS_MIN_FREQ_HZ, frame_rate, true);
+	design_biquad(&vs->coeffs[5], VITAL_SIGNS_MAX_FREQ_HZ, frame_rate, false);
+
+	const float step = (VITAL_SIGNS_MAX_FREQ_HZ - VITAL_SIGNS_MIN_FREQ_HZ) / (float)(VITAL_SIGNS_SPECTRUM_BINS - 1);
+	for(uint16_t i = 0; i < VITAL_SIGNS_SPECTRUM_BINS; ++i)
+	{
+		vs->frequencies[i] = VITAL_SIGNS_MIN_FREQ_HZ + step * (float) i;
+		const float w = 2.f * PI * vs->frequencies[i] / frame_rate;
+		vs->rotation[2*i] = cosf(w);
+		vs->rotation[2*i + 1] = sinf(w);
+	}
+
+	vs->settle_frames = (uint32_t)(VITAL_SIGNS_TIME_CONSTANT_S * frame_rate);
+	vs->forgetting = 1.f - (1.f / (float) vs->settle_frames);
+
+	vital_signs_reset(vs);
+
+	return 0;
+}
+
+void vital_signs_reset(vital_signs_t* vs)
+{
+	vs->phase_valid = false;
+	vs->unwrapped_phase = 0;
+	vs->frame_count = 0;
+
+	memset(vs->state, 0, sizeof(vs->state));
+	memset(vs->accumulator, 0, sizeof(vs->accumulator));
+	arm_biquad_cascade_df1_init_f32(&vs->filter, VITAL_SIGNS_BIQUAD_STAGES, vs->coeffs, vs->state);
+
+	memset(&vs->result, 0, sizeof(vs->result));
+}
+
+/**
+ * @brief Unwrap the phase of the new sample
+ */
+static float track_phase(vital_signs_t* vs, cfloat32_t sample, uint16_t bin)
+{
+	const float phase = atan2f(CIMAG_F32(sample), CREAL_F32(sample));
+
+	if (vs->phase_valid && (vs->bin == bin))
+	{
+		float delta = phase - vs->last_phase;
+		if (delta > PI) delta -= 2.f * PI;
+		else if (delta < -PI) delta += 2.f * PI;
+		vs->unwrapped_phase += delta;
+	}
+	// else: new bin -> keep the unwrapped phase where it is (no step at the filter input)
+
+	vs->phase_valid = true;
+	vs->bin = bin;
+	vs->last_phase = phase;
+
+	return vs->unwrapped_phase;
+}
+
+/**
+ * @brief Update the recursive DFT of each frequency and extract the maximum
+ * X[n] = forgetting * X[n-1] * exp(jw) + x[n]
+ */
+static void update_spectrum(vital_signs_t* vs, float value)
+{
+	float max_power = 0;
+	float sum_power = 0;
+	uint16_t max_idx = 0;
+	float power[VITAL_SIGNS_SPECTRUM_BINS];
+
+	for(uint16_t i = 0; i < VITAL_SIGNS_SPECTRUM_BINS; ++i)
+	{
+		const float re = vs->accumulator[2*i];
+		const float im = vs->accumulator[2*i + 1];
+		const float c = vs->rotation[2*i];
+		const float s = vs->rotation[2*i + 1];
+
+		vs->accumulator[2*i] = vs->forgetting * (re * c - im * s) + value;
+		vs->accumulator[2*i + 1] = vs->forgetting * (re * s + im * c);
+
+		power[i] = (vs->accumulator[2*i] * vs->accumulator[2*i]) + (vs->accumulator[2*i + 1] * vs->accumulator[2*i + 1]);
+		sum_power += power[i];
+		if (power[i] > max_power)
+		{
+			max_power = power[i];
+			max_idx = i;
+		}
+	}
+
+	// Parabolic interpolation between the evaluated frequencies
+	float offset = 0;
+	if ((max_idx > 0) && (max_idx < VITAL_SIGNS_SPECTRUM_BINS - 1))
+	{
+		const float denominator = power[max_idx - 1] - 2.f * power[max_idx] + power[max_idx + 1];
+		if (denominator != 0) offset = 0.5f * (power[max_idx - 1] - power[max_idx + 1]) / denominator;
+	}
+	const float step = vs->frequencies[1] - vs->frequencies[0];
+
+	vs->result.respiration_rate = (vs->frequencies[max_idx] + offset * step) * 60.f;
+	vs->result.confidence = (sum_power > 0) ? (max_power * VITAL_SIGNS_SPECTRUM_BINS) / sum_power : 0;
+}
+
+void vital_signs_update(vital_signs_t* vs, cfloat32_t sample, uint16_t bin)
+{
+	float phase = track_phase(vs, sample, bin);
+	float filtered = 0;
+
+	arm_biquad_cascade_df1_f32(&vs->filter, &phase, &filtered, 1);
+	update_spectrum(vs, filtered);
+
+	vs->frame_count++;
+	vs->result.phase = phase;
+	vs->result.filtered_phase = filtered;
+	vs->result.valid = (vs->frame_count >= vs->settle_frames);
+}
+
+const vital_signs_result_t* vital_signs_get_result(const vital_signs_t* vs)
+{
+	return &vs->result;
+}
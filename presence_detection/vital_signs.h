@@ -0,0 +1,116 @@
+/*
+ * vital_signs.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef PRESENCE_DETECTION_VITAL_SIGNS_H_
+#define PRESENCE_DETECTION_VITAL_SIGNS_H_
+
+#include "ifx_sensor_dsp.h"
+
+/**
+ * @def VITAL_SIGNS_BIQUAD_STAGES
+ * @brief Number of biquad stages of the band-pass filter (high-pass + low-pass)
+ */
+#define VITAL_SIGNS_BIQUAD_STAGES		2
+
+/**
+ * @def VITAL_SIGNS_SPECTRUM_BINS
+ * @brief Number of frequencies evaluated by the spectral estimator (bounds the cost per frame)
+ */
+#define VITAL_SIGNS_SPECTRUM_BINS		16
+
+/**
+ * @def VITAL_SIGNS_MIN_FREQ_HZ
+ * @brief Lowest respiration frequency (6 breaths per minute)
+ */
+#define VITAL_SIGNS_MIN_FREQ_HZ			0.1f
+
+/**
+ * @def VITAL_SIGNS_MAX_FREQ_HZ
+ * @brief Highest respiration frequency (36 breaths per minute)
+ */
+#define VITAL_SIGNS_MAX_FREQ_HZ			0.6f
+
+/**
+ * @def VITAL_SIGNS_TIME_CONSTANT_S
+ * @brief Memory of the spectral estimator
+ */
+#define VITAL_SIGNS_TIME_CONSTANT_S		20.f
+
+typedef struct
+{
+	float respiration_rate;	/**< Respiration rate in breaths per minute */
+	float confidence;		/**< Peak power / mean power of the estimated spectrum (1 -> flat) */
+	float phase;			/**< Unwrapped phase of the tracked bin (rad) */
+	float filtered_phase;	/**< Band-pass filtered phase (rad) */
+	bool valid;				/**< True once the estimator observed at least one time constant */
+} vital_signs_result_t;
+
+typedef struct
+{
+	// Phase tracking
+	bool phase_valid;
+	uint16_t bin;
+	float last_phase;
+	float unwrapped_phase;
+
+	// Band-pass filter (direct form I). Float: the input is the unwrapped phase, which is not bounded
+	// (it drifts with the target) and cannot be given a fixed Q format. The Cortex-M4 FPU runs the 2 stages in a few cycles
+	arm_biquad_casd_df1_inst_f32 filter;
+	float32_t coeffs[5 * VITAL_SIGNS_BIQUAD_STAGES];
+	float32_t state[4 * VITAL_SIGNS_BIQUAD_STAGES];
+
+	// Spectral estimator (bank of exponentially weighted recursive DFT)
+	float forgetting;
+	float rotation[2 * VITAL_SIGNS_SPECTRUM_BINS];
+	float accumulator[2 * VITAL_SIGNS_SPECTRUM_BINS];
+	float frequencies[VITAL_SIGNS_SPECTRUM_BINS];
+
+	uint32_t frame_count;
+	uint32_t settle_frames;
+
+	vital_signs_result_t result;
+} vital_signs_t;
+
+/**
+ * @brief Initialize the vital-sign estimator
+ *
+ * @param [out] vs	Estimator to be initialized
+ * @param [in] frame_rate	Frame rate in Hz (slow-time sampling rate)
+ *
+ * @retval 0 	Success
+ * @retval -1	Frame rate too low to observe the respiration band
+ */
+int vital_signs_init(vital_signs_t* vs, float frame_rate);
+
+/**
+ * @brief Restart the estimation (filter states and spectrum are cleared)
+ */
+void vital_signs_reset(vital_signs_t* vs);
+
+/**
+ * @brief Feed the estimator with the slow-time sample of the tracked bin for the current frame
+ * Cost is constant per frame: one atan2, VITAL_SIGNS_BIQUAD_STAGES biquads and VITAL_SIGNS_SPECTRUM_BINS complex MACs
+ *
+ * @param [inout] vs	Estimator
+ * @param [in] sample	Slow-time sample of the tracked bin
+ * @param [in] bin	Index of the tracked bin. If the bin changes, the phase tracking is re-seeded without discontinuity
+ */
+void vital_signs_update(vital_signs_t* vs, cfloat32_t sample, uint16_t bin);
+
+/**
+ * @brief Get the last estimation
+ */
+const vital_signs_result_t* vital_signs_get_result(const vital_signs_t* vs);
+
+#endif /* PRESENCE_DETECTION_VITAL_SIGNS_H_ */
@@ -0,0 +1,69 @@
+/*
+ * window.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+
+#include "window.h"
+
+int window_generate(window_type_t type, float* win, uint16_t len)
+{
+	switch(type)
+	{
+		case WINDOW_NONE:
+			for(uint16_t i = 0; i < len; ++i)
+			{
+				win[i] = 1.f;
+			}
+			return 0;
+
+		case WINDOW_HANN:
+			ifx_window_hann_f32(win, len);
+			return 0;
+
+		case WINDOW_HAMMING:
+			ifx_window_hamming_f32(win, len);
+			return 0;
+
+		case WINDOW_BLACKMAN_HARRIS:
+			ifx_window_blackmanharris_f32(win, len);
+			return 0;
+
+		case WINDOW_CHEBYSHEV:
+			ifx_window_chebyshev_f32(win, len, WINDOW_CHEBYSHEV_ATTENUATION_DB);
+			return 0;
+
+		default:
+			return -1;
+	}
+}
+
+float window_get_coherent_gain(const float* win, uint16_t len)
+{
+	float sum = 0;
+	for(uint16_t i = 0; i < len; ++i)
+	{
+		sum += win[i];
+	}
+	return sum / (float) len;
+}
+
+int window_generate_normalized(window_type_t type, float* win, uint16_t len, float scale)
+{
+	if (window_generate(type, win, len) != 0) return -1;
+
+	const float gain = window_get_coherent_gain(win, len);
+	if (gain <= 0) return -1;
+
+	arm_scale_f32(win, scale / gain, win, len);
+	return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * window.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef PRESENCE_DETECTION_WINDOW_H_
+#define PRESENCE_DETECTION_WINDOW_H_
+
+#include "ifx_sensor_dsp.h"
+
+/**
+ * @def WINDOW_CHEBYSHEV_ATTENUATION_DB
+ * @brief Side lobe attenuation of the Chebyshev window (same value inside scripts/generate_radar_tables.py)
+ */
+#define WINDOW_CHEBYSHEV_ATTENUATION_DB		80.f
+
+/**
+ * Window applied before a FFT
+ * The order is also the order of the window tables of radar_tables.h
+ */
+typedef enum
+{
+	WINDOW_NONE = 0,			/**< Rectangular */
+	WINDOW_HANN,
+	WINDOW_HAMMING,
+	WINDOW_BLACKMAN_HARRIS,
+	WINDOW_CHEBYSHEV,			/**< WINDOW_CHEBYSHEV_ATTENUATION_DB side lobe attenuation */
+	WINDOW_TYPE_COUNT
+} window_type_t;
+
+/**
+ * @brief Compute a window (symmetric, peak close to 1)
+ *
+ * @param [in] type	Window type
+ * @param [out] win	Destination, len values
+ * @param [in] len	Length of the window
+ *
+ * @retval 0 	Success
+ * @retval != 0	Invalid type
+ */
+int window_generate(window_type_t type, float* win, uint16_t len);
+
+/**
+ * @brief Coherent gain of a window (mean of its values)
+ * A sine wave at the center of a bin has a FFT magnitude of amplitude * len * coherent gain / 2
+ */
+float window_get_coherent_gain(const float* win, uint16_t len);
+
+/**
+ * @brief Compute a window normalized by its coherent gain (gain 1 -> the magnitudes do not depend on the window)
+ *
+ * @param [in] type	Window type
+ * @param [out] win	Destination, len values
+ * @param [in] len	Length of the window
+ * @param [in] scale	Additional scaling folded inside the window (e.g. ADC scaling)
+ *
+ * @retval 0 	Success
+ * @retval != 0	Invalid type
+ */
+int window_generate_normalized(window_type_t type, float* win, uint16_t len, float scale);
+
+#endif /* PRESENCE_DETECTION_WINDOW_H_ */
@@ -0,0 +1,98 @@
+/*
+ * radar_profiles.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "radar_profiles.h"
+
+#define XENSIV_BGT60TRXX_CONF_IMPL
+#include "radar_settings.h"
+
+#if (XENSIV_BGT60TRXX_CONF_NUM_REGS > RADAR_PROFILE_MAX_REGS)
+#error "RADAR_PROFILE_MAX_REGS must hold the registers of radar_settings.h"
+#endif
+
+/**
+ * 61.02 - 61.48 GHz, 128 samples per chirp, 64 chirps per frame, 2 RX antennas, 1 frame per second
+ */
+static const uint32_t low_freq_register_list[] = {
+    0x11e8270UL,
+    0x3088210UL,
+    0x9e967fdUL,
+    0xb0805b4UL,
+    0xd102fffUL,
+    0xf010700UL,
+    0x11000000UL,
+    0x13000000UL,
+    0x15000000UL,
+    0x17000be0UL,
+    0x19000000UL,
+    0x1b000000UL,
+    0x1d000000UL,
+    0x1f000b60UL,
+    0x21133c51UL,
+    0x235ff41fUL,
+    0x25006f7bUL,
+    0x2d000490UL,
+    0x3b000480UL,
+    0x49000480UL,
+    0x57000480UL,
+    0x5911be0eUL,
+    0x5b84c40aUL,
+    0x5d03f000UL,
+    0x5f787e1eUL,
+    0x61f51fe8UL,
+    0x630000a4UL,
+    0x65000252UL,
+    0x67000080UL,
+    0x69000000UL,
+    0x6b000000UL,
+    0x6d000000UL,
+    0x6f093910UL,
+    0x7f000100UL,
+    0x8f000100UL,
+    0x9f000100UL,
+    0xad000000UL,
+    0xb7000000UL,
+};
+
+const radar_profile_t radar_profiles[RADAR_PROFILE_COUNT] =
+{
+	[RADAR_PROFILE_DEFAULT] =
+	{
+		.name = "default",
+		.registers = register_list,
+		.register_count = XENSIV_BGT60TRXX_CONF_NUM_REGS,
+		.rx_antennas = XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS,
+		.chirps_per_frame = XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME,
+		.samples_per_chirp = XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP,
+		.sample_rate = XENSIV_BGT60TRXX_CONF_SAMPLE_RATE,
+		.start_freq = XENSIV_BGT60TRXX_CONF_START_FREQ_HZ,
+		.end_freq = XENSIV_BGT60TRXX_CONF_END_FREQ_HZ,
+		.chirp_repetition_time = XENSIV_BGT60TRXX_CONF_CHIRP_REPETITION_TIME_S,
+		.frame_repetition_time = XENSIV_BGT60TRXX_CONF_FRAME_REPETITION_TIME_S,
+	},
+	[RADAR_PROFILE_LOW_FREQ] =
+	{
+		.name = "low frequency",
+		.registers = low_freq_register_list,
+		.register_count = sizeof(low_freq_register_list) / sizeof(low_freq_register_list[0]),
+		.rx_antennas = 2,
+		.chirps_per_frame = 64,
+		.samples_per_chirp = 128,
+		.sample_rate = 2352941,
+		.start_freq = 61020000000ULL,
+		.end_freq = 61480000000ULL,
+		.chirp_repetition_time = 6.99625e-05f,
+		.frame_repetition_time = 1.00167f,
+	},
+};
@@ -0,0 +1,56 @@
+/*
+ * radar_profiles.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef RADAR_PROFILES_H_
+#define RADAR_PROFILES_H_
+
+#include <stdint.h>
+
+/**
+ * @def RADAR_PROFILE_MAX_REGS
+ * @brief Maximum number of registers of a profile (size of the encoded configurations)
+ */
+#define RADAR_PROFILE_MAX_REGS		40
+
+/**
+ * Radar profiles (index inside radar_profiles)
+ */
+typedef enum
+{
+	RADAR_PROFILE_DEFAULT = 0,		/**< radar_settings.h: 16 chirps, 1 RX antenna, 10 frames per second */
+	RADAR_PROFILE_LOW_FREQ,			/**< 64 chirps, 2 RX antennas, 1 frame per second */
+	RADAR_PROFILE_COUNT,
+} radar_profile_id_t;
+
+/**
+ * Register list exported by the Radar Fusion GUI and the configuration it describes
+ */
+typedef struct
+{
+	const char* name;
+	const uint32_t* registers;
+	uint8_t register_count;			/**< <= RADAR_PROFILE_MAX_REGS */
+	uint8_t rx_antennas;
+	uint16_t chirps_per_frame;
+	uint16_t samples_per_chirp;
+	uint32_t sample_rate;
+	uint64_t start_freq;
+	uint64_t end_freq;
+	float chirp_repetition_time;	/**< Time between two chirps in seconds */
+	float frame_repetition_time;	/**< Time between two frames in seconds */
+} radar_profile_t;
+
+extern const radar_profile_t radar_profiles[RADAR_PROFILE_COUNT];
+
+#endif /* RADAR_PROFILES_H_ */
@@ -0,0 +1,193 @@
+/*
+ * scheduler.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "scheduler.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct
+{
+	scheduler_task_func_t func;
+	uint32_t events;
+} scheduler_task_t;
+
+/**
+ * Platform hooks
+ */
+static const scheduler_platform_t* platform = NULL;
+
+static scheduler_task_t tasks[SCHEDULER_MAX_TASKS];
+static uint8_t task_count = 0;
+
+/**
+ * Events posted and not processed yet (set from the interrupts)
+ */
+static volatile uint32_t pending_events = 0;
+
+/**
+ * Events posted at delayed_time (set from the tasks)
+ */
+static uint32_t delayed_events = 0;
+static uint32_t delayed_time = 0;
+
+/**
+ * Statistics
+ */
+static uint64_t idle_time = 0;
+static uint64_t total_time = 0;
+static uint32_t last_time = 0;
+static uint32_t wakeups = 0;
+static uint32_t task_runs = 0;
+
+/**
+ * @brief Accumulate the time elapsed since the last call (the timer wraps around)
+ */
+static uint32_t update_time()
+{
+	const uint32_t now = platform->get_time();
+	total_time += (uint32_t)(now - last_time);
+	last_time = now;
+	return now;
+}
+
+int scheduler_init(const scheduler_platform_t* platform_hooks)
+{
+	if ((platform_hooks == NULL) || (platform_hooks->get_time == NULL) || (platform_hooks->sleep == NULL)) return -1;
+	if ((platform_hooks->critical_enter == NULL) || (platform_hooks->critical_exit == NULL)) return -1;
+
+	platform = platform_hooks;
+	task_count = 0;
+	pending_events = 0;
+	delayed_events = 0;
+	scheduler_reset_stats();
+
+	return 0;
+}
+
+int scheduler_add_task(scheduler_task_func_t task, uint32_t events)
+{
+	if ((task == NULL) || (events == 0)) return -1;
+	if (task_count >= SCHEDULER_MAX_TASKS) return -2;
+
+	tasks[task_count].func = task;
+	tasks[task_count].events = events;
+	task_count++;
+
+	return 0;
+}
+
+void scheduler_post(uint32_t events)
+{
+	const uint32_t state = platform->critical_enter();
+	pending_events |= events;
+	platform->critical_exit(state);
+}
+
+void scheduler_post_delayed(uint32_t events, uint32_t delay)
+{
+	const uint32_t time = platform->get_time() + delay;
+	if ((delayed_events == 0) || ((int32_t)(time - delayed_time) < 0))
+	{
+		delayed_time = time;
+	}
+	delayed_events |= events;
+}
+
+void scheduler_run_once()
+{
+	// Check and sleep with masked interrupts: an event posted after the check wakes the sleep up
+	const uint32_t state = platform->critical_enter();
+	uint32_t events = pending_events;
+	pending_events = 0;
+
+	// Delayed events: run once due, else the alarm wakes the sleep up at the deadline (no sleep without alarm)
+	bool may_sleep = (events == 0);
+	if (delayed_events != 0)
+	{
+		const int32_t remaining = (int32_t)(delayed_time - platform->get_time());
+		if (remaining <= 0)
+		{
+			events |= delayed_events;
+			delayed_events = 0;
+			may_sleep = false;
+		}
+		else if (platform->set_alarm == NULL)
+		{
+			may_sleep = false;
+		}
+		else if (may_sleep)
+		{
+			platform->set_alarm((uint32_t) remaining);
+		}
+	}
+
+	if (may_sleep)
+	{
+		const uint32_t start = update_time();
+		platform->sleep();
+		idle_time += (uint32_t)(update_time() - start);
+		wakeups++;
+
+		// The interrupt runs once unmasked
+		platform->critical_exit(state);
+		return;
+	}
+	platform->critical_exit(state);
+
+	for (uint8_t i = 0; i < task_count; ++i)
+	{
+		const uint32_t task_events = events & tasks[i].events;
+		if (task_events != 0)
+		{
+			tasks[i].func(task_events);
+			task_runs++;
+		}
+	}
+}
+
+void scheduler_run()
+{
+	for(;;)
+	{
+		scheduler_run_once();
+	}
+}
+
+void scheduler_get_stats(scheduler_stats_t* stats)
+{
+	if (stats == NULL) return;
+
+	const uint32_t state = platform->critical_enter();
+	update_time();
+	stats->idle_time = idle_time;
+	stats->total_time = total_time;
+	stats->wakeups = wakeups;
+	stats->task_runs = task_runs;
+	platform->critical_exit(state);
+
+	stats->idle_percent = (stats->total_time != 0) ? (100.f * (float) stats->idle_time / (float) stats->total_time) : 0;
+}
+
+void scheduler_reset_stats()
+{
+	idle_time = 0;
+	total_time = 0;
+	wakeups = 0;
+	task_runs = 0;
+	if (platform != NULL)
+	{
+		last_time = platform->get_time();
+	}
+}
@@ -0,0 +1,95 @@
+/*
+ * scheduler.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include <stdint.h>
+
+/**
+ * @def SCHEDULER_MAX_TASKS
+ * @brief Maximum number of tasks
+ */
+#define SCHEDULER_MAX_TASKS	4
+
+/**
+ * @brief Task, called with the pending events of its mask
+ */
+typedef void (*scheduler_task_func_t)(uint32_t events);
+
+/**
+ * Platform hooks (hardware or simulated interrupt source)
+ */
+typedef struct
+{
+	uint32_t (*get_time)(void);				/**< Free running time in us (wraps around) */
+	uint32_t (*critical_enter)(void);		/**< Mask the interrupts, returns the state to restore */
+	void (*critical_exit)(uint32_t state);
+	void (*sleep)(void);					/**< Wait for an interrupt (WFI). Called with masked interrupts:
+											 * must return when an interrupt is pending */
+	void (*set_alarm)(uint32_t delay);		/**< Raise an interrupt in delay us (replaces the previous alarm),
+											 * wakes the sleep up for the delayed events. Can be NULL:
+											 * no sleep while delayed events are pending */
+} scheduler_platform_t;
+
+typedef struct
+{
+	uint64_t idle_time;		/**< Time spent sleeping in us */
+	uint64_t total_time;	/**< Time since the start of the statistics in us */
+	float idle_percent;		/**< 100 * idle_time / total_time (headroom left by the processing) */
+	uint32_t wakeups;		/**< Number of sleeps */
+	uint32_t task_runs;		/**< Number of task calls */
+} scheduler_stats_t;
+
+/**
+ * @retval 0 Success
+ * @retval -1 Invalid platform
+ */
+int scheduler_init(const scheduler_platform_t* platform);
+
+/**
+ * @brief Register a task, run each time one of its events is posted
+ *
+ * @retval 0 Success
+ * @retval -1 Invalid task
+ * @retval -2 Too many tasks
+ */
+int scheduler_add_task(scheduler_task_func_t task, uint32_t events);
+
+/**
+ * @brief Post events (interrupt safe)
+ */
+void scheduler_post(uint32_t events);
+
+/**
+ * @brief Post events once delay us have elapsed (not interrupt safe, called by the tasks)
+ * A single deadline is kept: events delayed meanwhile are posted at the earliest deadline
+ */
+void scheduler_post_delayed(uint32_t events, uint32_t delay);
+
+/**
+ * @brief Run the tasks of the pending events, or sleep until an interrupt if no event is pending
+ */
+void scheduler_run_once();
+
+/**
+ * @brief Run the scheduler forever
+ */
+void scheduler_run();
+
+void scheduler_get_stats(scheduler_stats_t* stats);
+
+void scheduler_reset_stats();
+
+#endif /* SCHEDULER_H_ */
@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+#
+# generate_radar_tables.py
+#
+#  Created on: 18 Oct 2026
+#      Author: jorda
+#
+# Generates presence_detection/radar_tables.c/.h from the XENSIV_BGT60TRXX_CONF_*
+# values of radar_settings.h. The tables are const (stored in flash):
+# - range windows (one per window_type_t) normalized by their coherent gain and
+#   pre-multiplied by the ADC scaling 1/4096
+# - same range windows in Q15 (not normalized, without ADC scaling) for the fixed-point pipeline
+# - Doppler windows (one per window_type_t) normalized by their coherent gain
+# - range (real) and Doppler (complex) FFT plans referencing the CMSIS-DSP tables
+# - bin to meters axis of the range FFT
+#
+# Called by the PREBUILD step of the Makefile. The files are only rewritten
+# if their content changes (no useless rebuild).
+#
+# Usage: generate_radar_tables.py <radar_settings.h> <output directory> [-DNAME ...]
+#
+# Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+# including the software is for testing purposes only and,
+# because it has limited functions and limited resilience, is not suitable
+# for permanent use under real conditions. If the evaluation board is
+# nevertheless used under real conditions, this is done at one's responsibility;
+# any liability of Rutronik is insofar excluded
+
+import cmath
+import math
+import os
+import re
+import sys
+
+SPEED_OF_LIGHT = 299792458.0
+ADC_SCALE = 1.0 / 4096.0
+
+# Same value as WINDOW_CHEBYSHEV_ATTENUATION_DB (window.h)
+CHEBYSHEV_ATTENUATION_DB = 80.0
+
+CFFT_LENGTHS = (16, 32, 64, 128, 256, 512, 1024, 2048, 4096)
+
+
+def parse_settings(path, defines):
+    """Minimal preprocessor: handles #define, #undef, #ifdef, #ifndef, #if defined(), #else, #endif"""
+    values = {}
+    defined = set(defines)
+    stack = []  # (active, branch_taken)
+
+    def active():
+        return all(a for a, _ in stack)
+
+    with open(path) as f:
+        for line in f:
+            line = line.split('//')[0].strip()
+            m = re.match(r'#\s*(\w+)\s*(.*)', line)
+            if not m:
+                continue
+            directive, rest = m.group(1), m.group(2).strip()
+            if directive in ('ifdef', 'ifndef', 'if'):
+                if directive == 'if':
+                    dm = re.match(r'defined\s*\(?\s*(\w+)\s*\)?', rest)
+                    cond = dm is not None and dm.group(1) in defined
+                else:
+                    cond = (rest in defined) == (directive == 'ifdef')
+                stack.append((cond, cond))
+            elif directive == 'else':
+                _, taken = stack.pop()
+                stack.append((not taken, True))
+            elif directive == 'endif':
+                stack.pop()
+            elif not active():
+                continue
+            elif directive == 'undef':
+                defined.discard(rest)
+            elif directive == 'define':
+                dm = re.match(r'(\w+)\s*(.*)', rest)
+                name = dm.group(1)
+                defined.add(name)
+                if name.startswith('XENSIV_BGT60TRXX_CONF_'):
+                    values[name] = dm.group(2).strip().strip('()').strip()
+    return values
+
+
+def blackman_harris(n):
+    a0, a1, a2, a3 = 0.35875, 0.48829, 0.14128, 0.01168
+    return [a0
+            - a1 * math.cos(2 * math.pi * i / (n - 1))
+            + a2 * math.cos(4 * math.pi * i / (n - 1))
+            - a3 * math.cos(6 * math.pi * i / (n - 1)) for i in range(n)]
+
+
+def rectangular(n):
+    return [1.0] * n
+
+
+def hann(n):
+    return [0.5 - 0.5 * math.cos(2 * math.pi * i / (n - 1)) for i in range(n)]
+
+
+def hamming(n):
+    return [0.54 - 0.46 * math.cos(2 * math.pi * i / (n - 1)) for i in range(n)]
+
+
+def chebyshev(n, attenuation_db=CHEBYSHEV_ATTENUATION_DB):
+    """Dolph-Chebyshev window (frequency sampling of the Chebyshev polynomial), peak normalized to 1"""
+    order = n - 1
+    beta = math.cosh(math.acosh(10 ** (attenuation_db / 20.0)) / order)
+
+    def cheb_poly(x):
+        if x > 1:
+            return math.cosh(order * math.acosh(x))
+        if x < -1:
+            return (2 * (n % 2) - 1) * math.cosh(order * math.acosh(-x))
+        return math.cos(order * math.acos(x))
+
+    p = [cheb_poly(beta * math.cos(math.pi * k / n)) for k in range(n)]
+    if n % 2 == 0:
+        p = [p[k] * cmath.exp(1j * math.pi * k / n) for k in range(n)]
+    w = [sum(p[k] * cmath.exp(-2j * math.pi * k * m / n) for k in range(n)).real for m in range(n)]
+    if n % 2:
+        half = (n + 1) // 2
+        w = w[half - 1:0:-1] + w[:half]
+    else:
+        half = n // 2 + 1
+        w = w[half - 1:0:-1] + w[1:half]
+    peak = max(w)
+    return [v / peak for v in w]
+
+
+# Order of window_type_t (window.h)
+WINDOWS = (('WINDOW_NONE', rectangular), ('WINDOW_HANN', hann), ('WINDOW_HAMMING', hamming),
+           ('WINDOW_BLACKMAN_HARRIS', blackman_harris), ('WINDOW_CHEBYSHEV', chebyshev))
+
+
+def normalized(window, scale=1.0):
+    # Coherent gain normalization (magnitudes do not depend on the window)
+    gain = sum(window) / len(window)
+    return [w * scale / gain for w in window]
+
+
+def bin_to_meters(bin_idx, samples_per_chirp, sampling_rate, start_freq, end_freq):
+    # Same math as presence_detection_bin_to_meters
+    bandwidth = end_freq - start_freq
+    fftlen = samples_per_chirp / 2
+    fractionfs = bin_idx / ((fftlen - 1) * 2)
+    freq = fractionfs * sampling_rate
+    slope = bandwidth / (samples_per_chirp * (1.0 / sampling_rate))
+    return (SPEED_OF_LIGHT * freq) / (2.0 * slope)
+
+
+def format_floats(values, per_line=6):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ' '.join('%.9ef,' % v for v in values[i:i + per_line]))
+    return '\n'.join(lines)
+
+
+def format_q15(values, per_line=12):
+    q15 = [max(-32768, min(32767, int(round(v * 32768)))) for v in values]
+    lines = []
+    for i in range(0, len(q15), per_line):
+        lines.append('\t' + ' '.join('%d,' % v for v in q15[i:i + per_line]))
+    return '\n'.join(lines)
+
+
+def format_rows(windows, formatter):
+    rows = []
+    for name, window in windows:
+        rows.append('\t/* %s */\n\t{\n%s\n\t},' % (name, '\n'.join('\t' + line for line in formatter(window).split('\n'))))
+    return '\n'.join(rows)
+
+
+def write_if_changed(path, content):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == content:
+                return
+    with open(path, 'w') as f:
+        f.write(content)
+
+
+HEADER_BANNER = '''/*
+ * {name}
+ *
+ * Generated by scripts/generate_radar_tables.py from radar_settings.h
+ * Do not edit: modify radar_settings.h and rebuild instead.
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+'''
+
+
+def generate(settings, out_dir):
+    samples = int(settings['XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP'])
+    chirps = int(settings['XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME'])
+    antennas = int(settings['XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS'])
+    sampling_rate = int(settings['XENSIV_BGT60TRXX_CONF_SAMPLE_RATE'])
+    start_freq = int(settings['XENSIV_BGT60TRXX_CONF_START_FREQ_HZ'])
+    end_freq = int(settings['XENSIV_BGT60TRXX_CONF_END_FREQ_HZ'])
+
+    if (samples // 2) not in CFFT_LENGTHS or chirps not in CFFT_LENGTHS:
+        sys.exit('generate_radar_tables: unsupported FFT length (samples %d, chirps %d)' % (samples, chirps))
+
+    range_windows = [(name, func(samples)) for name, func in WINDOWS]
+    doppler_windows = [(name, func(chirps)) for name, func in WINDOWS]
+    axis = [bin_to_meters(i, samples, sampling_rate, start_freq, end_freq) for i in range(samples // 2)]
+
+    half = samples // 2
+    h = HEADER_BANNER.format(name='radar_tables.h')
+    h += '''
+#ifndef PRESENCE_DETECTION_RADAR_TABLES_H_
+#define PRESENCE_DETECTION_RADAR_TABLES_H_
+
+#include "ifx_sensor_dsp.h"
+
+#define RADAR_TABLES_NUM_SAMPLES_PER_CHIRP		({samples})
+#define RADAR_TABLES_NUM_CHIRPS_PER_FRAME		({chirps})
+#define RADAR_TABLES_NUM_RX_ANTENNAS			({antennas})
+#define RADAR_TABLES_SAMPLE_RATE				({sampling_rate}UL)
+#define RADAR_TABLES_START_FREQ_HZ				({start_freq}ULL)
+#define RADAR_TABLES_END_FREQ_HZ				({end_freq}ULL)
+
+#define RADAR_TABLES_WINDOW_COUNT				({window_count})
+
+/**
+ * @var radar_tables_range_window
+ * Windows of RADAR_TABLES_NUM_SAMPLES_PER_CHIRP points indexed by window_type_t,
+ * normalized by their coherent gain and multiplied by 1/4096 (ADC scaling)
+ */
+extern const float32_t radar_tables_range_window[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_SAMPLES_PER_CHIRP];
+
+/**
+ * @var radar_tables_range_window_q15
+ * Windows of RADAR_TABLES_NUM_SAMPLES_PER_CHIRP points indexed by window_type_t in Q15 (not normalized, without ADC scaling)
+ */
+extern const q15_t radar_tables_range_window_q15[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_SAMPLES_PER_CHIRP];
+
+/**
+ * @var radar_tables_doppler_window
+ * Windows of RADAR_TABLES_NUM_CHIRPS_PER_FRAME points indexed by window_type_t, normalized by their coherent gain
+ */
+extern const float32_t radar_tables_doppler_window[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_CHIRPS_PER_FRAME];
+
+/**
+ * @var radar_tables_range_rfft
+ * Real FFT plan of RADAR_TABLES_NUM_SAMPLES_PER_CHIRP points
+ */
+extern const arm_rfft_fast_instance_f32 radar_tables_range_rfft;
+
+/**
+ * @var radar_tables_doppler_cfft
+ * Complex FFT plan of RADAR_TABLES_NUM_CHIRPS_PER_FRAME points
+ */
+extern const arm_cfft_instance_f32* const radar_tables_doppler_cfft;
+
+/**
+ * @var radar_tables_range_axis
+ * Distance in meters of each range bin
+ */
+extern const float32_t radar_tables_range_axis[RADAR_TABLES_NUM_SAMPLES_PER_CHIRP / 2];
+
+#endif /* PRESENCE_DETECTION_RADAR_TABLES_H_ */
+'''.format(samples=samples, chirps=chirps, antennas=antennas, sampling_rate=sampling_rate,
+           start_freq=start_freq, end_freq=end_freq, window_count=len(WINDOWS))
+
+    c = HEADER_BANNER.format(name='radar_tables.c')
+    c += '''
+#include "radar_tables.h"
+
+#include "arm_common_tables.h"
+#include "arm_const_structs.h"
+
+const float32_t radar_tables_range_window[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_SAMPLES_PER_CHIRP] = {{
+{range_window}
+}};
+
+const q15_t radar_tables_range_window_q15[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_SAMPLES_PER_CHIRP] = {{
+{range_window_q15}
+}};
+
+const float32_t radar_tables_doppler_window[RADAR_TABLES_WINDOW_COUNT][RADAR_TABLES_NUM_CHIRPS_PER_FRAME] = {{
+{doppler_window}
+}};
+
+const arm_rfft_fast_instance_f32 radar_tables_range_rfft = {{
+	{{ {half}, twiddleCoef_{half}, armBitRevIndexTable{half}, ARMBITREVINDEXTABLE_{half}_TABLE_LENGTH }},
+	{samples},
+	twiddleCoef_rfft_{samples}
+}};
+
+const arm_cfft_instance_f32* const radar_tables_doppler_cfft = &arm_cfft_sR_f32_len{chirps};
+
+const float32_t radar_tables_range_axis[RADAR_TABLES_NUM_SAMPLES_PER_CHIRP / 2] = {{
+{axis}
+}};
+'''.format(range_window=format_rows(range_windows, lambda w: format_floats(normalized(w, ADC_SCALE))),
+           range_window_q15=format_rows(range_windows, format_q15),
+           doppler_window=format_rows(doppler_windows, lambda w: format_floats(normalized(w))),
+           half=half, samples=samples, chirps=chirps, axis=format_floats(axis))
+
+    write_if_changed(os.path.join(out_dir, 'radar_tables.h'), h)
+    write_if_changed(os.path.join(out_dir, 'radar_tables.c'), c)
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.exit('Usage: generate_radar_tables.py <radar_settings.h> <output directory> [-DNAME ...]')
+    defines = [a[2:].split('=')[0] for a in argv[3:] if a.startswith('-D')]
+    generate(parse_settings(argv[1], defines), argv[2])
+
+
+if __name__ == '__main__':
+    main(sys.argv)
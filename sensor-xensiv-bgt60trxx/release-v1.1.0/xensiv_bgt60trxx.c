@@ -46,6 +46,11 @@
 #define XENSIV_BGT60TRXX_SPI_BURST_MODE_RWB_POS         (16U)
 #define XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_MSK         (0x0000FE00UL)
 #define XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_POS         (9U)
+#define XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_MAX         (XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_MSK >> \
+                                                         XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_POS)
+
+/* Registers written per burst by xensiv_bgt60trxx_config (size of the burst buffer on the stack) */
+#define XENSIV_BGT60TRXX_CONFIG_BURST_MAX_REGS          (16U)
 
 
 //struct xensiv_bgt60trxx_type
@@ -106,6 +111,35 @@ static xensiv_bgt60trxx_device_t detect_device_type(uint32_t chipid)
 }
 
 
+/* Write-through update of the register shadow */
+static void shadow_store(xensiv_bgt60trxx_t* dev, uint32_t reg_addr, uint32_t data)
+{
+    if (reg_addr < XENSIV_BGT60TRXX_SHADOW_NUM_REGS)
+    {
+        if (reg_addr == XENSIV_BGT60TRXX_REG_MAIN)
+        {
+            /* Self-clearing bits: must not be triggered again by a read-modify-write */
+            data &= (uint32_t) ~(XENSIV_BGT60TRXX_REG_MAIN_FRAME_START_MSK |
+                                 XENSIV_BGT60TRXX_REG_MAIN_RESET_MSK);
+        }
+
+        dev->shadow[reg_addr] = data & XENSIV_BGT60TRXX_SPI_DATA_MSK;
+        dev->shadow_valid[reg_addr / 32U] |= (1UL << (reg_addr % 32U));
+    }
+}
+
+
+void xensiv_bgt60trxx_invalidate_shadow(xensiv_bgt60trxx_t* dev)
+{
+    xensiv_bgt60trxx_platform_assert(dev != NULL);
+
+    for (uint32_t idx = 0U; idx < (sizeof(dev->shadow_valid) / sizeof(dev->shadow_valid[0])); ++idx)
+    {
+        dev->shadow_valid[idx] = 0U;
+    }
+}
+
+
 int32_t xensiv_bgt60trxx_init(xensiv_bgt60trxx_t* dev,
                               void* iface,
                               bool high_speed)
@@ -117,6 +151,9 @@ int32_t xensiv_bgt60trxx_init(xensiv_bgt60trxx_t* dev,
 
     dev->iface = iface;
     dev->high_speed = high_speed;
+    dev->fifo_read_busy = false;
+    dev->fifo_read_gsr0 = 0U;
+    xensiv_bgt60trxx_invalidate_shadow(dev);
 
     //xensiv_bgt60trxx_hard_reset(dev);
 
@@ -156,6 +193,125 @@ int32_t xensiv_bgt60trxx_init(xensiv_bgt60trxx_t* dev,
 }
 
 
+/* Register data of a configuration entry (the FIFO limit and the SPI speed mode are not taken
+ * from the configuration) */
+static uint32_t get_config_reg_data(const xensiv_bgt60trxx_t* dev, uint32_t val, uint32_t* reg_addr)
+{
+    *reg_addr = ((val & XENSIV_BGT60TRXX_SPI_REGADR_MSK) >> XENSIV_BGT60TRXX_SPI_REGADR_POS);
+    uint32_t reg_data = ((val & XENSIV_BGT60TRXX_SPI_DATA_MSK) >> XENSIV_BGT60TRXX_SPI_DATA_POS);
+
+    if (*reg_addr == XENSIV_BGT60TRXX_REG_SFCTL)
+    {
+        /* FIFO limit set by user */
+        reg_data &= (uint32_t) ~XENSIV_BGT60TRXX_REG_SFCTL_FIFO_CREF_MSK;
+        if (dev->high_speed)
+        {
+            reg_data |= (uint32_t)XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK;
+        }
+        else
+        {
+            reg_data &= (uint32_t) ~XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK;
+        }
+    }
+
+    return reg_data;
+}
+
+
+/* Encodes one SPI burst write (header + 24 bits per register, MSB first) holding the longest run
+ * of consecutive register addresses at the beginning of regs (at most max_regs registers).
+ * Returns the number of registers encoded */
+static uint32_t encode_burst(const xensiv_bgt60trxx_t* dev,
+                             const uint32_t* regs,
+                             uint32_t len,
+                             uint8_t* buffer,
+                             uint32_t max_regs)
+{
+    uint32_t start_addr = 0U;
+    uint32_t count = 0U;
+    uint8_t* data = &buffer[XENSIV_BGT60TRXX_SPI_BURST_HEADER_SIZE_BYTES];
+
+    while ((count < len) && (count < max_regs))
+    {
+        uint32_t reg_addr;
+        uint32_t reg_data = get_config_reg_data(dev, regs[count], &reg_addr);
+
+        if (count == 0U)
+        {
+            start_addr = reg_addr;
+        }
+        else if (reg_addr != (start_addr + count))
+        {
+            break;
+        }
+
+        *data++ = (uint8_t)(reg_data >> 16U);
+        *data++ = (uint8_t)(reg_data >> 8U);
+        *data++ = (uint8_t)reg_data;
+        ++count;
+    }
+
+    uint32_t header = XENSIV_BGT60TRXX_SPI_BURST_MODE_CMD |
+                      ((start_addr << XENSIV_BGT60TRXX_SPI_BURST_MODE_SADR_POS) &
+                       XENSIV_BGT60TRXX_SPI_BURST_MODE_SADR_MSK) |
+                      XENSIV_BGT60TRXX_SPI_BURST_MODE_RWB_MSK |
+                      ((count << XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_POS) &
+                       XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_MSK);
+
+    buffer[0] = (uint8_t)(header >> 24U);
+    buffer[1] = (uint8_t)(header >> 16U);
+    buffer[2] = (uint8_t)(header >> 8U);
+    buffer[3] = (uint8_t)header;
+
+    return count;
+}
+
+
+/* Size in bytes of an encoded burst */
+static uint32_t get_burst_size(const uint8_t* buffer)
+{
+    uint32_t header = ((uint32_t)buffer[0] << 24U) | ((uint32_t)buffer[1] << 16U) |
+                      ((uint32_t)buffer[2] << 8U) | (uint32_t)buffer[3];
+    uint32_t count = (header & XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_MSK) >>
+                     XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_POS;
+
+    return XENSIV_BGT60TRXX_SPI_BURST_HEADER_SIZE_BYTES +
+           (count * XENSIV_BGT60TRXX_REG_DATA_SIZE_BYTES);
+}
+
+
+/* Sends an encoded burst in a single SPI transfer */
+static int32_t write_burst(xensiv_bgt60trxx_t* dev, const uint8_t* buffer)
+{
+    xensiv_bgt60trxx_platform_spi_cs_set(dev->iface, false);
+    /* The transmit buffer is only read */
+    int32_t status = xensiv_bgt60trxx_platform_spi_transfer(dev->iface,
+                                                            (uint8_t*)buffer,
+                                                            NULL,
+                                                            get_burst_size(buffer));
+    xensiv_bgt60trxx_platform_spi_cs_set(dev->iface, true);
+
+    if (XENSIV_BGT60TRXX_STATUS_OK == status)
+    {
+        uint32_t start_addr = ((uint32_t)buffer[1] << 16U) &
+                              XENSIV_BGT60TRXX_SPI_BURST_MODE_SADR_MSK;
+        start_addr >>= XENSIV_BGT60TRXX_SPI_BURST_MODE_SADR_POS;
+        uint32_t count = (get_burst_size(buffer) - XENSIV_BGT60TRXX_SPI_BURST_HEADER_SIZE_BYTES) /
+                         XENSIV_BGT60TRXX_REG_DATA_SIZE_BYTES;
+        const uint8_t* data = &buffer[XENSIV_BGT60TRXX_SPI_BURST_HEADER_SIZE_BYTES];
+
+        for (uint32_t reg_idx = 0U; reg_idx < count; ++reg_idx)
+        {
+            shadow_store(dev, start_addr + reg_idx,
+                         ((uint32_t)data[0] << 16U) | ((uint32_t)data[1] << 8U) | (uint32_t)data[2]);
+            data += XENSIV_BGT60TRXX_REG_DATA_SIZE_BYTES;
+        }
+    }
+
+    return status;
+}
+
+
 int32_t xensiv_bgt60trxx_config(xensiv_bgt60trxx_t* dev,
                                 const uint32_t* regs,
                                 uint32_t len)
@@ -166,45 +322,65 @@ int32_t xensiv_bgt60trxx_config(xensiv_bgt60trxx_t* dev,
     int32_t status = xensiv_bgt60trxx_soft_reset(dev,
                                                  XENSIV_BGT60TRXX_RESET_SW);
 
-    if (XENSIV_BGT60TRXX_STATUS_OK == status)
+    /* Apply register configuration: one burst per run of consecutive register addresses */
+    uint8_t burst[XENSIV_BGT60TRXX_SPI_BURST_HEADER_SIZE_BYTES +
+                  (XENSIV_BGT60TRXX_CONFIG_BURST_MAX_REGS * XENSIV_BGT60TRXX_REG_DATA_SIZE_BYTES)];
+    uint32_t reg_idx = 0U;
+    while ((XENSIV_BGT60TRXX_STATUS_OK == status) && (reg_idx < len))
     {
-        /* Apply register configuration */
-        for (uint32_t reg_idx = 0; reg_idx < len; ++reg_idx)
-        {
-            uint32_t val = regs[reg_idx];
-            uint32_t reg_addr = ((val & XENSIV_BGT60TRXX_SPI_REGADR_MSK) >>
-                                 XENSIV_BGT60TRXX_SPI_REGADR_POS);
-            uint32_t reg_data = ((val & XENSIV_BGT60TRXX_SPI_DATA_MSK) >>
-                                 XENSIV_BGT60TRXX_SPI_DATA_POS);
+        reg_idx += encode_burst(dev, &regs[reg_idx], len - reg_idx, burst,
+                                XENSIV_BGT60TRXX_CONFIG_BURST_MAX_REGS);
+        status = write_burst(dev, burst);
+    }
 
-            if (reg_addr == XENSIV_BGT60TRXX_REG_SFCTL)
-            {
-                /* FIFO limit set by user */
-                reg_data &= (uint32_t) ~XENSIV_BGT60TRXX_REG_SFCTL_FIFO_CREF_MSK;
-                if (dev->high_speed)
-                {
-                    reg_data |= (uint32_t)XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK;
-                }
-                else
-                {
-                    reg_data &= (uint32_t) ~XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK;
-                }
-            }
+    return status;
+}
 
-            status = xensiv_bgt60trxx_set_reg(dev, reg_addr, reg_data);
 
-            if (status != XENSIV_BGT60TRXX_STATUS_OK)
-            {
-                break;
-            }
-        }
+uint32_t xensiv_bgt60trxx_config_encode(const xensiv_bgt60trxx_t* dev,
+                                        const uint32_t* regs,
+                                        uint32_t len,
+                                        uint8_t* buffer)
+{
+    xensiv_bgt60trxx_platform_assert(dev != NULL);
+    xensiv_bgt60trxx_platform_assert(regs != NULL);
+    xensiv_bgt60trxx_platform_assert(buffer != NULL);
+
+    uint32_t size = 0U;
+    uint32_t reg_idx = 0U;
+    while (reg_idx < len)
+    {
+        reg_idx += encode_burst(dev, &regs[reg_idx], len - reg_idx, &buffer[size],
+                                XENSIV_BGT60TRXX_SPI_BURST_MODE_LEN_MAX);
+        size += get_burst_size(&buffer[size]);
+    }
+
+    return size;
+}
+
+
+int32_t xensiv_bgt60trxx_config_encoded(xensiv_bgt60trxx_t* dev,
+                                        const uint8_t* buffer,
+                                        uint32_t size)
+{
+    xensiv_bgt60trxx_platform_assert(dev != NULL);
+    xensiv_bgt60trxx_platform_assert(buffer != NULL);
+
+    int32_t status = xensiv_bgt60trxx_soft_reset(dev,
+                                                 XENSIV_BGT60TRXX_RESET_SW);
+
+    uint32_t pos = 0U;
+    while ((XENSIV_BGT60TRXX_STATUS_OK == status) && (pos < size))
+    {
+        status = write_burst(dev, &buffer[pos]);
+        pos += get_burst_size(&buffer[pos]);
     }
 
     return status;
 }
 
 
-int32_t xensiv_bgt60trxx_set_reg(const xensiv_bgt60trxx_t* dev, uint32_t reg_addr, uint32_t data)
+int32_t xensiv_bgt60trxx_set_reg(xensiv_bgt60trxx_t* dev, uint32_t reg_addr, uint32_t data)
 {
     xensiv_bgt60trxx_platform_assert(dev != NULL);
 
@@ -222,6 +398,11 @@ int32_t xensiv_bgt60trxx_set_reg(const xensiv_bgt60trxx_t* dev, uint32_t reg_add
                                                             XENSIV_BGT60TRXX_SPI_REG_XFER_LEN_BYTES);
     xensiv_bgt60trxx_platform_spi_cs_set(dev->iface, 1);
 
+    if (XENSIV_BGT60TRXX_STATUS_OK == status)
+    {
+        shadow_store(dev, reg_addr, data);
+    }
+
     return status;
 }
 
@@ -253,6 +434,23 @@ int32_t xensiv_bgt60trxx_get_reg(const xensiv_bgt60trxx_t* dev, uint32_t reg_add
 }
 
 
+int32_t xensiv_bgt60trxx_get_reg_cached(const xensiv_bgt60trxx_t* dev, uint32_t reg_addr,
+                                        uint32_t* data)
+{
+    xensiv_bgt60trxx_platform_assert(dev != NULL);
+    xensiv_bgt60trxx_platform_assert(data != NULL);
+
+    if ((reg_addr < XENSIV_BGT60TRXX_SHADOW_NUM_REGS) &&
+        ((dev->shadow_valid[reg_addr / 32U] & (1UL << (reg_addr % 32U))) != 0U))
+    {
+        *data = dev->shadow[reg_addr];
+        return XENSIV_BGT60TRXX_STATUS_OK;
+    }
+
+    return xensiv_bgt60trxx_get_reg(dev, reg_addr, data);
+}
+
+
 uint16_t xensiv_bgt60trxx_get_fifo_size(const xensiv_bgt60trxx_t* dev)
 {
     return (dev->type->fifo_size);
@@ -265,14 +463,14 @@ xensiv_bgt60trxx_device_t xensiv_bgt60trxx_get_device(const xensiv_bgt60trxx_t*
 }
 
 
-int32_t xensiv_bgt60trxx_set_fifo_limit(const xensiv_bgt60trxx_t* dev, uint32_t num_samples)
+int32_t xensiv_bgt60trxx_set_fifo_limit(xensiv_bgt60trxx_t* dev, uint32_t num_samples)
 {
     xensiv_bgt60trxx_platform_assert(dev != NULL);
     xensiv_bgt60trxx_platform_assert((num_samples % 2U) == 0U);
     xensiv_bgt60trxx_platform_assert((num_samples / 2U) <= dev->type->fifo_size);
 
     uint32_t tmp;
-    int32_t retval = xensiv_bgt60trxx_get_reg(dev, XENSIV_BGT60TRXX_REG_SFCTL, &tmp);
+    int32_t retval = xensiv_bgt60trxx_get_reg_cached(dev, XENSIV_BGT60TRXX_REG_SFCTL, &tmp);
 
     if (XENSIV_BGT60TRXX_STATUS_OK == retval)
     {
@@ -330,6 +528,132 @@ int32_t xensiv_bgt60trxx_get_fifo_data(const xensiv_bgt60trxx_t* dev, uint16_t*
 }
 
 
+/* End of an asynchronous FIFO read */
+static void fifo_read_complete(xensiv_bgt60trxx_t* dev, int32_t status)
+{
+    xensiv_bgt60trxx_platform_spi_cs_set(dev->iface, true);
+    dev->fifo_read_busy = false;
+
+    if (dev->fifo_read_callback != NULL)
+    {
+        dev->fifo_read_callback(dev->fifo_read_callback_arg, status);
+    }
+}
+
+
+static void fifo_read_data_done(void* arg, int32_t status)
+{
+    fifo_read_complete((xensiv_bgt60trxx_t*)arg, status);
+}
+
+
+/* Burst command sent: check GSR0 and chain the FIFO read */
+static void fifo_read_header_done(void* arg, int32_t status)
+{
+    xensiv_bgt60trxx_t* dev = (xensiv_bgt60trxx_t*)arg;
+
+    if (XENSIV_BGT60TRXX_STATUS_OK == status)
+    {
+        dev->fifo_read_gsr0 =
+            (xensiv_bgt60trxx_platform_word_reverse(dev->fifo_read_header[1]) &
+             XENSIV_BGT60TRXX_SPI_GSR0_MSK) >> XENSIV_BGT60TRXX_SPI_GSR0_POS;
+
+        if ((dev->fifo_read_header[1] & (XENSIV_BGT60TRXX_REG_GSR0_FOU_ERR_MSK |
+                                         XENSIV_BGT60TRXX_REG_GSR0_SPI_BURST_ERR_MSK |
+                                         XENSIV_BGT60TRXX_REG_GSR0_CLK_NUM_ERR_MSK)) == 0U)
+        {
+            status = xensiv_bgt60trxx_platform_spi_fifo_read_async(dev->iface,
+                                                                   dev->fifo_read_data,
+                                                                   dev->fifo_read_num_samples,
+                                                                   fifo_read_data_done,
+                                                                   dev);
+            if (XENSIV_BGT60TRXX_STATUS_OK == status)
+            {
+                return;
+            }
+        }
+        else
+        {
+            status = XENSIV_BGT60TRXX_STATUS_GSR0_ERROR;
+        }
+    }
+
+    fifo_read_complete(dev, status);
+}
+
+
+int32_t xensiv_bgt60trxx_get_fifo_data_async(xensiv_bgt60trxx_t* dev,
+                                             uint16_t* data,
+                                             uint32_t num_samples,
+                                             xensiv_bgt60trxx_fifo_read_callback_t callback,
+                                             void* arg)
+{
+    xensiv_bgt60trxx_platform_assert(dev != NULL);
+    xensiv_bgt60trxx_platform_assert(data != NULL);
+    xensiv_bgt60trxx_platform_assert((num_samples % 2U) == 0U);
+    xensiv_bgt60trxx_platform_assert((num_samples / 2U) <= dev->type->fifo_size);
+
+    if (dev->fifo_read_busy)
+    {
+        return XENSIV_BGT60TRXX_STATUS_BUSY;
+    }
+
+    dev->fifo_read_busy = true;
+    dev->fifo_read_data = data;
+    dev->fifo_read_num_samples = num_samples;
+    dev->fifo_read_callback = callback;
+    dev->fifo_read_callback_arg = arg;
+    dev->fifo_read_gsr0 = 0U;
+    dev->fifo_read_header[0] = xensiv_bgt60trxx_platform_word_reverse(
+        XENSIV_BGT60TRXX_SPI_BURST_MODE_CMD |
+        (dev->type->fifo_addr << XENSIV_BGT60TRXX_SPI_BURST_MODE_SADR_POS));
+
+    /* SPI read burst mode command, the FIFO read is started on completion */
+    xensiv_bgt60trxx_platform_spi_cs_set(dev->iface, false);
+
+    int32_t retval = xensiv_bgt60trxx_platform_spi_transfer_async(dev->iface,
+                                                                  (uint8_t*)&dev->fifo_read_header[0],
+                                                                  (uint8_t*)&dev->fifo_read_header[1],
+                                                                  XENSIV_BGT60TRXX_SPI_REG_XFER_LEN_BYTES,
+                                                                  fifo_read_header_done,
+                                                                  dev);
+
+    if (XENSIV_BGT60TRXX_STATUS_OK != retval)
+    {
+        xensiv_bgt60trxx_platform_spi_cs_set(dev->iface, true);
+        dev->fifo_read_busy = false;
+    }
+
+    return retval;
+}
+
+
+void xensiv_bgt60trxx_abort_fifo_data_async(xensiv_bgt60trxx_t* dev)
+{
+    xensiv_bgt60trxx_platform_assert(dev != NULL);
+
+    if (dev->fifo_read_busy)
+    {
+        /* The aborted transfer completes with an error: the read ends through fifo_read_complete */
+        xensiv_bgt60trxx_platform_spi_abort_async(dev->iface);
+    }
+
+    if (dev->fifo_read_busy)
+    {
+        /* No transfer was in progress (lost between the burst command and the FIFO read) */
+        fifo_read_complete(dev, XENSIV_BGT60TRXX_STATUS_COM_ERROR);
+    }
+}
+
+
+uint32_t xensiv_bgt60trxx_get_fifo_read_gsr0(const xensiv_bgt60trxx_t* dev)
+{
+    xensiv_bgt60trxx_platform_assert(dev != NULL);
+
+    return dev->fifo_read_gsr0;
+}
+
+
 int32_t xensiv_bgt60trxx_get_fifo_status(const xensiv_bgt60trxx_t* dev, uint32_t* status)
 {
     xensiv_bgt60trxx_platform_assert(dev != NULL);
@@ -341,7 +665,7 @@ int32_t xensiv_bgt60trxx_get_fifo_status(const xensiv_bgt60trxx_t* dev, uint32_t
 }
 
 
-int32_t xensiv_bgt60trxx_start_frame(const xensiv_bgt60trxx_t* dev, bool start)
+int32_t xensiv_bgt60trxx_start_frame(xensiv_bgt60trxx_t* dev, bool start)
 {
     xensiv_bgt60trxx_platform_assert(dev != NULL);
 
@@ -350,7 +674,7 @@ int32_t xensiv_bgt60trxx_start_frame(const xensiv_bgt60trxx_t* dev, bool start)
 
     if (start)
     {
-        status = xensiv_bgt60trxx_get_reg(dev, XENSIV_BGT60TRXX_REG_MAIN, &tmp);
+        status = xensiv_bgt60trxx_get_reg_cached(dev, XENSIV_BGT60TRXX_REG_MAIN, &tmp);
         if (status == XENSIV_BGT60TRXX_STATUS_OK)
         {
             tmp |= XENSIV_BGT60TRXX_REG_MAIN_FRAME_START_MSK;
@@ -368,7 +692,7 @@ int32_t xensiv_bgt60trxx_start_frame(const xensiv_bgt60trxx_t* dev, bool start)
 }
 
 
-int32_t xensiv_bgt60trxx_soft_reset(const xensiv_bgt60trxx_t* dev,
+int32_t xensiv_bgt60trxx_soft_reset(xensiv_bgt60trxx_t* dev,
                                     xensiv_bgt60trxx_reset_t reset_type)
 {
     xensiv_bgt60trxx_platform_assert(dev != NULL);
@@ -376,7 +700,7 @@ int32_t xensiv_bgt60trxx_soft_reset(const xensiv_bgt60trxx_t* dev,
     uint32_t tmp;
     int32_t status;
 
-    status = xensiv_bgt60trxx_get_reg(dev, XENSIV_BGT60TRXX_REG_MAIN, &tmp);
+    status = xensiv_bgt60trxx_get_reg_cached(dev, XENSIV_BGT60TRXX_REG_MAIN, &tmp);
     if (XENSIV_BGT60TRXX_STATUS_OK == status)
     {
         tmp |= (uint32_t)reset_type;
@@ -409,18 +733,25 @@ int32_t xensiv_bgt60trxx_soft_reset(const xensiv_bgt60trxx_t* dev,
         }
     }
 
+    if ((((uint32_t)reset_type & (uint32_t)XENSIV_BGT60TRXX_RESET_SW) != 0U) ||
+        (XENSIV_BGT60TRXX_STATUS_OK != status))
+    {
+        /* All registers are back to their default values (or unknown) */
+        xensiv_bgt60trxx_invalidate_shadow(dev);
+    }
+
     return status;
 }
 
 
-int32_t xensiv_bgt60trxx_enable_data_test_mode(const xensiv_bgt60trxx_t* dev, bool enable)
+int32_t xensiv_bgt60trxx_enable_data_test_mode(xensiv_bgt60trxx_t* dev, bool enable)
 {
     xensiv_bgt60trxx_platform_assert(dev != NULL);
 
     uint32_t tmp;
     int32_t status;
 
-    status = xensiv_bgt60trxx_get_reg(dev, XENSIV_BGT60TRXX_REG_SFCTL, &tmp);
+    status = xensiv_bgt60trxx_get_reg_cached(dev, XENSIV_BGT60TRXX_REG_SFCTL, &tmp);
     if (XENSIV_BGT60TRXX_STATUS_OK == status)
     {
         if (enable)
@@ -439,13 +770,45 @@ int32_t xensiv_bgt60trxx_enable_data_test_mode(const xensiv_bgt60trxx_t* dev, bo
 }
 
 
+int32_t xensiv_bgt60trxx_enable_high_speed(xensiv_bgt60trxx_t* dev, bool enable)
+{
+    xensiv_bgt60trxx_platform_assert(dev != NULL);
+
+    uint32_t tmp;
+    int32_t status;
+
+    status = xensiv_bgt60trxx_get_reg_cached(dev, XENSIV_BGT60TRXX_REG_SFCTL, &tmp);
+    if (XENSIV_BGT60TRXX_STATUS_OK == status)
+    {
+        if (enable)
+        {
+            tmp |= XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK;
+        }
+        else
+        {
+            tmp &= (uint32_t) ~XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK;
+        }
+
+        status = xensiv_bgt60trxx_set_reg(dev, XENSIV_BGT60TRXX_REG_SFCTL, tmp);
+    }
+
+    if (XENSIV_BGT60TRXX_STATUS_OK == status)
+    {
+        /* Used by the next configurations */
+        dev->high_speed = enable;
+    }
+
+    return status;
+}
+
+
 /* Because the reset input is multiplexed with the quad SPI data line
    DIO3 the SPI CS signal must be HIGH all time during a reset
    condition.
 
    The reset signal of the connected device must be driven low
    and kept low for at least 1000ns, before going HIGH again. */
-void xensiv_bgt60trxx_hard_reset(const xensiv_bgt60trxx_t* dev)
+void xensiv_bgt60trxx_hard_reset(xensiv_bgt60trxx_t* dev)
 {
     xensiv_bgt60trxx_platform_assert(dev != NULL);
     xensiv_bgt60trxx_platform_assert(dev->iface != NULL);
@@ -462,6 +825,8 @@ void xensiv_bgt60trxx_hard_reset(const xensiv_bgt60trxx_t* dev)
     xensiv_bgt60trxx_platform_rst_set(dev->iface, true);
 
     xensiv_bgt60trxx_platform_delay(1U);
+
+    xensiv_bgt60trxx_invalidate_shadow(dev);
 }
 
 
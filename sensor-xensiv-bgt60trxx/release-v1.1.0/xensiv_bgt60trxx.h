@@ -61,6 +61,8 @@
 #define XENSIV_BGT60TRXX_STATUS_TIMEOUT_ERROR           (3)
 /** Result code indicating that an error occurred while reading from FIFO. */
 #define XENSIV_BGT60TRXX_STATUS_GSR0_ERROR              (4)
+/** Result code indicating that an asynchronous FIFO read is still in progress. */
+#define XENSIV_BGT60TRXX_STATUS_BUSY                    (5)
 
 /** Initial value of the LFSR test sequence generator. */
 #define XENSIV_BGT60TRXX_INITIAL_TEST_WORD              (0x0001U)
@@ -74,6 +76,20 @@
 /** Size of the header in the SPI burst transfer. */
 #define XENSIV_BGT60TRXX_SPI_BURST_HEADER_SIZE_BYTES    (4U)
 
+/** Size of the data of a register in a SPI burst write (24 bits). */
+#define XENSIV_BGT60TRXX_REG_DATA_SIZE_BYTES            (3U)
+
+/** Maximum size in bytes of a register configuration encoded by
+ * \ref xensiv_bgt60trxx_config_encode (one burst per register in the worst case). */
+#define XENSIV_BGT60TRXX_CONFIG_ENCODED_SIZE(len)       ((len) * \
+                                                         (XENSIV_BGT60TRXX_SPI_BURST_HEADER_SIZE_BYTES + \
+                                                          XENSIV_BGT60TRXX_REG_DATA_SIZE_BYTES))
+
+/** Number of registers (addresses 0 to N - 1) held by the register shadow. */
+#ifndef XENSIV_BGT60TRXX_SHADOW_NUM_REGS
+#define XENSIV_BGT60TRXX_SHADOW_NUM_REGS                (0x80U)
+#endif
+
 /** Timeout for wait on software reset done. */
 #ifndef XENSIV_BGT60TRXX_RESET_WAIT_TIMEOUT
 #define XENSIV_BGT60TRXX_RESET_WAIT_TIMEOUT             (0xFFFFFFFFU)
@@ -116,6 +132,10 @@ struct xensiv_bgt60trxx_type
 };
 
 
+/** Function called when an asynchronous FIFO read is completed (\ref xensiv_bgt60trxx_get_fifo_data_async).
+ * status is XENSIV_BGT60TRXX_STATUS_OK if the data are valid; else an error indicating what went wrong. */
+typedef void (*xensiv_bgt60trxx_fifo_read_callback_t)(void* arg, int32_t status);
+
 /** \cond INTERNAL */
 /* Forward declaration of structure holding device specific type info */
 struct xensiv_bgt60trxx_type;
@@ -133,6 +153,16 @@ typedef struct
                       xensiv_bgt60trxx_platform_spi_transfer function */
     const struct xensiv_bgt60trxx_type* type; /**< Device type detected during initialization */
     bool high_speed; /**< SPI speed mode */
+    uint32_t shadow[XENSIV_BGT60TRXX_SHADOW_NUM_REGS]; /**< Last value written to each register */
+    uint32_t shadow_valid[(XENSIV_BGT60TRXX_SHADOW_NUM_REGS + 31U) / 32U]; /**< One bit per register:
+                                                                               shadow value valid */
+    volatile bool fifo_read_busy; /**< Asynchronous FIFO read in progress */
+    uint32_t fifo_read_header[2]; /**< Burst command sent and GSR0 received by the asynchronous read */
+    uint32_t fifo_read_gsr0; /**< GSR0 flags received by the last asynchronous read */
+    uint16_t* fifo_read_data; /**< Destination of the asynchronous read */
+    uint32_t fifo_read_num_samples; /**< Number of samples of the asynchronous read */
+    xensiv_bgt60trxx_fifo_read_callback_t fifo_read_callback; /**< Completion callback */
+    void* fifo_read_callback_arg; /**< Argument of the completion callback */
 } xensiv_bgt60trxx_t;
 
 /******************************* Function prototypes *************************************/
@@ -171,6 +201,7 @@ xensiv_bgt60trxx_device_t xensiv_bgt60trxx_get_device(const xensiv_bgt60trxx_t*
 /**
  * @brief Configures the XENSIV(TM) BGT60TRxx radar sensor device.
  * It performs a SW reset and applies the sensor configurator given in the regs array
+ * (one SPI burst write per run of consecutive register addresses).
  * The register configuration can be generated using the BGT60TRxx configurator tool.
  *
  * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
@@ -183,6 +214,39 @@ int32_t xensiv_bgt60trxx_config(xensiv_bgt60trxx_t* dev,
                                 const uint32_t* regs,
                                 uint32_t len);
 
+/**
+ * @brief Encodes a register configuration as SPI burst writes.
+ * Each run of consecutive register addresses of the regs array becomes one burst write
+ * (4 bytes header followed by 3 bytes per register). The FIFO limit and the SPI speed mode
+ * are handled as in \ref xensiv_bgt60trxx_config. The result can be applied several times
+ * with \ref xensiv_bgt60trxx_config_encoded.
+ *
+ * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object (initialized).
+ * @param[in] regs Pointer to the configuration registers list.
+ * @param[in] len Length of the configuration registers list.
+ * @param[out] buffer Encoded configuration. Size must be XENSIV_BGT60TRXX_CONFIG_ENCODED_SIZE(len).
+ * @return Size of the encoded configuration in bytes.
+ */
+uint32_t xensiv_bgt60trxx_config_encode(const xensiv_bgt60trxx_t* dev,
+                                        const uint32_t* regs,
+                                        uint32_t len,
+                                        uint8_t* buffer);
+
+/**
+ * @brief Configures the XENSIV(TM) BGT60TRxx radar sensor device with an encoded configuration.
+ * It performs a SW reset and sends each burst of the encoded configuration in a single SPI transfer.
+ * @note The SW reset clears the FIFO limit: call \ref xensiv_bgt60trxx_set_fifo_limit afterwards.
+ *
+ * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
+ * @param[in] buffer Configuration encoded by \ref xensiv_bgt60trxx_config_encode.
+ * @param[in] size Size of the encoded configuration in bytes.
+ * @return XENSIV_BGT60TRXX_STATUS_OK if the configuration was successful; else an error indicating
+ * what went wrong.
+ */
+int32_t xensiv_bgt60trxx_config_encoded(xensiv_bgt60trxx_t* dev,
+                                        const uint8_t* buffer,
+                                        uint32_t size);
+
 /**
  * @brief Writes the given data buffer into the sensor device.
  * Writes the given data buffer to the sensor register map starting at the register address.
@@ -193,7 +257,7 @@ int32_t xensiv_bgt60trxx_config(xensiv_bgt60trxx_t* dev,
  * @return XENSIV_BGT60TRXX_STATUS_OK if writing to the sensor register wash successful; else an
  * error indicating what went wrong.
  */
-int32_t xensiv_bgt60trxx_set_reg(const xensiv_bgt60trxx_t* dev,
+int32_t xensiv_bgt60trxx_set_reg(xensiv_bgt60trxx_t* dev,
                                  uint32_t reg_addr,
                                  uint32_t data);
 
@@ -212,6 +276,33 @@ int32_t xensiv_bgt60trxx_get_reg(const xensiv_bgt60trxx_t* dev,
                                  uint32_t reg_addr,
                                  uint32_t* data);
 
+/**
+ * @brief Reads a register from the register shadow.
+ * Every register written by the driver is kept in a write-through shadow. If the register was
+ * written since the last SW/hard reset, its value is returned without any SPI transfer; otherwise
+ * it is read from the sensor (\ref xensiv_bgt60trxx_get_reg). Used by the read-modify-write
+ * operations of the driver. Status registers are never written, thus always read from the sensor.
+ * @note The self-clearing bits of the MAIN register (frame start, resets) are read as 0.
+ *
+ * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
+ * @param[in] reg_addr Register address.
+ * @param[out] data Value of the register.
+ * @return XENSIV_BGT60TRXX_STATUS_OK if the value is available; else an error indicating what
+ * went wrong.
+ */
+int32_t xensiv_bgt60trxx_get_reg_cached(const xensiv_bgt60trxx_t* dev,
+                                        uint32_t reg_addr,
+                                        uint32_t* data);
+
+/**
+ * @brief Invalidates the register shadow.
+ * Called by the driver after a SW reset and a hard reset. Must be called by the application
+ * if the registers are changed outside of the driver (e.g. power cycle of the sensor).
+ *
+ * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
+ */
+void xensiv_bgt60trxx_invalidate_shadow(xensiv_bgt60trxx_t* dev);
+
 /**
  * @brief Obtains the sensor device FIFO size.
  *
@@ -220,6 +311,52 @@ int32_t xensiv_bgt60trxx_get_reg(const xensiv_bgt60trxx_t* dev,
  */
 uint16_t xensiv_bgt60trxx_get_fifo_size(const xensiv_bgt60trxx_t* dev);
 
+/**
+ * @brief Starts reading the sensor device FIFO into the given data buffer and returns without
+ * waiting for the end of the transfer.
+ * Same data as \ref xensiv_bgt60trxx_get_fifo_data. The burst command and the FIFO read are
+ * chained by the platform asynchronous transfers: the CPU is free while the FIFO is read out
+ * and the function can be called from an interrupt. The callback is called from the platform
+ * completion context once the data are available (or an error occurred), CS is released before.
+ * No other SPI access to the sensor must be performed until the callback is called.
+ *
+ * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
+ * @param[out] data Pointer to a data buffer (must stay valid until the callback is called).
+ * @param[in] num_samples Number of samples to read from the sensor.
+ * @param[in] callback Function called when the read is completed.
+ * @param[in] arg Argument given to the callback.
+ * @return XENSIV_BGT60TRXX_STATUS_OK if the read is started (the callback will be called),
+ * XENSIV_BGT60TRXX_STATUS_BUSY if a read is already in progress; else an error indicating
+ * what went wrong (the callback will not be called).
+ */
+int32_t xensiv_bgt60trxx_get_fifo_data_async(xensiv_bgt60trxx_t* dev,
+                                             uint16_t* data,
+                                             uint32_t num_samples,
+                                             xensiv_bgt60trxx_fifo_read_callback_t callback,
+                                             void* arg);
+
+/**
+ * @brief Aborts the asynchronous FIFO read in progress (if any).
+ * The callback of the read is called with XENSIV_BGT60TRXX_STATUS_COM_ERROR and CS is released
+ * before the function returns. Used when the read does not complete.
+ *
+ * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
+ */
+void xensiv_bgt60trxx_abort_fifo_data_async(xensiv_bgt60trxx_t* dev);
+
+/**
+ * @brief Returns the GSR0 flags received with the burst command of the last asynchronous FIFO
+ * read (\ref xensiv_bgt60trxx_get_fifo_data_async).
+ *
+ * Enables to find out which error caused a XENSIV_BGT60TRXX_STATUS_GSR0_ERROR status
+ * (XENSIV_BGT60TRXX_REG_GSR0_FOU_ERR_MSK, XENSIV_BGT60TRXX_REG_GSR0_SPI_BURST_ERR_MSK,
+ * XENSIV_BGT60TRXX_REG_GSR0_CLK_NUM_ERR_MSK).
+ *
+ * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
+ * @return GSR0 flags, 0 if the burst command could not be transferred.
+ */
+uint32_t xensiv_bgt60trxx_get_fifo_read_gsr0(const xensiv_bgt60trxx_t* dev);
+
 /**
  * @brief Obtains the sensor device FIFO status.
  *
@@ -247,7 +384,7 @@ int32_t xensiv_bgt60trxx_get_fifo_status(const xensiv_bgt60trxx_t* dev,
  * @return XENSIV_BGT60TRXX_STATUS_OK if setting the new FIFO limit was successful; else
  * an error indicating what went wrong.
  */
-int32_t xensiv_bgt60trxx_set_fifo_limit(const xensiv_bgt60trxx_t* dev,
+int32_t xensiv_bgt60trxx_set_fifo_limit(xensiv_bgt60trxx_t* dev,
                                         uint32_t num_samples);
 
 /**
@@ -273,7 +410,7 @@ int32_t xensiv_bgt60trxx_get_fifo_data(const xensiv_bgt60trxx_t* dev,
  * @return XENSIV_BGT60TRXX_STATUS_OK if the starting the frame generation was successful,
  * else an error indicating what went wrong.
  */
-int32_t xensiv_bgt60trxx_start_frame(const xensiv_bgt60trxx_t* dev,
+int32_t xensiv_bgt60trxx_start_frame(xensiv_bgt60trxx_t* dev,
                                      bool start);
 
 /**
@@ -285,7 +422,7 @@ int32_t xensiv_bgt60trxx_start_frame(const xensiv_bgt60trxx_t* dev,
  * XENSIV_BGT60TRXX_STATUS_TIMEOUT_ERROR if a timeout occurs while waiting reset to finish;
  * else an error indicating what went wrong.
  */
-int32_t xensiv_bgt60trxx_soft_reset(const xensiv_bgt60trxx_t* dev,
+int32_t xensiv_bgt60trxx_soft_reset(xensiv_bgt60trxx_t* dev,
                                     xensiv_bgt60trxx_reset_t reset_type);
 
 /**
@@ -300,15 +437,30 @@ int32_t xensiv_bgt60trxx_soft_reset(const xensiv_bgt60trxx_t* dev,
  * @return XENSIV_BGT60TRXX_STATUS_OK if enabling the data testomode was successful; else
  * an error indicating what went wrong.
  */
-int32_t xensiv_bgt60trxx_enable_data_test_mode(const xensiv_bgt60trxx_t* dev,
+int32_t xensiv_bgt60trxx_enable_data_test_mode(xensiv_bgt60trxx_t* dev,
                                                bool enable);
 
+/**
+ * @brief Enables/disables the high speed mode of the SPI interface (MISO_HS_READ).
+ * In high speed mode the sensor sends out the data via DO with the rising edge instead of the
+ * falling edge of the CLK, which increases the timing budget on SPI master side at high SPI clocks.
+ * The mode is kept by the configurations written afterwards (\ref xensiv_bgt60trxx_config,
+ * \ref xensiv_bgt60trxx_config_encode).
+ *
+ * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
+ * @param[in] enable Enable/disable the high speed mode.
+ * @return XENSIV_BGT60TRXX_STATUS_OK if changing the SPI speed mode was successful; else
+ * an error indicating what went wrong.
+ */
+int32_t xensiv_bgt60trxx_enable_high_speed(xensiv_bgt60trxx_t* dev,
+                                           bool enable);
+
 /**
  * @brief Performs a hard reset of the sensor device.
  *
  * @param[in] dev Pointer to the XENSIV(TM) BGT60TRxx sensor device object.
  */
-void xensiv_bgt60trxx_hard_reset(const xensiv_bgt60trxx_t* dev);
+void xensiv_bgt60trxx_hard_reset(xensiv_bgt60trxx_t* dev);
 
 /**
  * @brief Utility function that generates test sequence data that can be used to compare against
@@ -41,6 +41,12 @@
  */
 #define SPI_TRANSFER_TIMEOUT_US		100000
 
+/**
+ * @def ASYNC_TRANSFER_EVENTS
+ * SPI events ending an asynchronous transfer
+ */
+#define ASYNC_TRANSFER_EVENTS		((cyhal_spi_event_t)(CYHAL_SPI_IRQ_DONE | CYHAL_SPI_IRQ_ERROR))
+
 
 /*******************************************************************************
  * Function Prototypes
@@ -58,6 +64,15 @@ static cy_rslt_t config_int(xensiv_bgt60trxx_mtb_interrupt_pin_t* intpin,
                             cyhal_gpio_event_callback_t callback,
                             void* callback_arg);
 
+static int32_t start_async_transfer(xensiv_bgt60trxx_mtb_iface_t* mtb_iface,
+                                    uint8_t* tx_data,
+                                    uint8_t* rx_data,
+                                    uint32_t len,
+                                    xensiv_bgt60trxx_platform_callback_t callback,
+                                    void* arg);
+
+static void async_transfer_end(xensiv_bgt60trxx_mtb_iface_t* mtb_iface, int32_t status);
+
 /*******************************************************************************
  * Public interface implementation
  ********************************************************************************/
@@ -79,6 +94,7 @@ cy_rslt_t xensiv_bgt60trxx_mtb_init(xensiv_bgt60trxx_mtb_t* obj,
     iface->spi = spi;
     iface->selpin = selpin;
     iface->rstpin = rstpin;
+    iface->async_callback = NULL;
     set_pin(&(iface->irqpin), NC);
 
     cy_rslt_t rslt = cyhal_gpio_init(selpin,
@@ -289,6 +305,56 @@ int32_t xensiv_bgt60trxx_platform_spi_fifo_read(void* iface,
 }
 
 
+int32_t xensiv_bgt60trxx_platform_spi_transfer_async(void* iface,
+                                                     uint8_t* tx_data,
+                                                     uint8_t* rx_data,
+                                                     uint32_t len,
+                                                     xensiv_bgt60trxx_platform_callback_t callback,
+                                                     void* arg)
+{
+    CY_ASSERT(iface != NULL);
+    CY_ASSERT((tx_data != NULL) || (rx_data != NULL));
+
+    return start_async_transfer(iface, tx_data, rx_data, len, callback, arg);
+}
+
+
+int32_t xensiv_bgt60trxx_platform_spi_fifo_read_async(void* iface,
+                                                      uint16_t* rx_data,
+                                                      uint32_t len,
+                                                      xensiv_bgt60trxx_platform_callback_t callback,
+                                                      void* arg)
+{
+    CY_ASSERT(iface != NULL);
+    CY_ASSERT(rx_data != NULL);
+
+    // Same transfer as xensiv_bgt60trxx_platform_spi_fifo_read (bytes, 12 bits per sample)
+    return start_async_transfer(iface, NULL, (uint8_t*)rx_data, (len * 12U) / 8U, callback, arg);
+}
+
+
+void xensiv_bgt60trxx_platform_spi_abort_async(void* iface)
+{
+    CY_ASSERT(iface != NULL);
+
+    xensiv_bgt60trxx_mtb_iface_t* mtb_iface = iface;
+
+    // The SPI interrupt must not end the transfer meanwhile
+    uint32_t saved = cyhal_system_critical_section_enter();
+    bool in_progress = (mtb_iface->async_callback != NULL);
+    if (in_progress)
+    {
+        Cy_SCB_SPI_AbortTransfer(mtb_iface->spi->base, &(mtb_iface->spi->context));
+    }
+    cyhal_system_critical_section_exit(saved);
+
+    if (in_progress)
+    {
+        async_transfer_end(mtb_iface, XENSIV_BGT60TRXX_STATUS_COM_ERROR);
+    }
+}
+
+
 void xensiv_bgt60trxx_platform_rst_set(const void* iface, bool val)
 {
     CY_ASSERT(iface != NULL);
@@ -335,6 +401,67 @@ void xensiv_bgt60trxx_platform_assert(bool expr)
 /*******************************************************************************
  * Static functions implementation
  ********************************************************************************/
+/* End of the asynchronous transfer (done, error or abort): the callback is called once */
+static void async_transfer_end(xensiv_bgt60trxx_mtb_iface_t* mtb_iface, int32_t status)
+{
+    // The synchronous transfers do not use the events
+    cyhal_spi_enable_event(mtb_iface->spi, ASYNC_TRANSFER_EVENTS, CYHAL_ISR_PRIORITY_DEFAULT, false);
+
+    xensiv_bgt60trxx_platform_callback_t callback = mtb_iface->async_callback;
+    mtb_iface->async_callback = NULL;
+    if (callback != NULL)
+    {
+        // The callback can start the next transfer
+        callback(mtb_iface->async_callback_arg, status);
+    }
+}
+
+
+/* SPI interrupt: end of the asynchronous transfer */
+static void async_transfer_event(void* callback_arg, cyhal_spi_event_t event)
+{
+    xensiv_bgt60trxx_mtb_iface_t* mtb_iface = callback_arg;
+
+    if ((event & CYHAL_SPI_IRQ_ERROR) != 0U)
+    {
+        async_transfer_end(mtb_iface, XENSIV_BGT60TRXX_STATUS_COM_ERROR);
+    }
+    else if ((event & CYHAL_SPI_IRQ_DONE) != 0U)
+    {
+        async_transfer_end(mtb_iface, XENSIV_BGT60TRXX_STATUS_OK);
+    }
+}
+
+
+static int32_t start_async_transfer(xensiv_bgt60trxx_mtb_iface_t* mtb_iface,
+                                    uint8_t* tx_data,
+                                    uint8_t* rx_data,
+                                    uint32_t len,
+                                    xensiv_bgt60trxx_platform_callback_t callback,
+                                    void* arg)
+{
+    mtb_iface->async_callback = callback;
+    mtb_iface->async_callback_arg = arg;
+
+    spi_set_data_width(mtb_iface->spi->base, 8U);
+    Cy_SCB_SetByteMode(mtb_iface->spi->base, true);
+
+    cyhal_spi_register_callback(mtb_iface->spi, async_transfer_event, mtb_iface);
+    cyhal_spi_enable_event(mtb_iface->spi, ASYNC_TRANSFER_EVENTS, CYHAL_ISR_PRIORITY_DEFAULT, true);
+
+    cy_en_scb_spi_status_t status = Cy_SCB_SPI_Transfer(mtb_iface->spi->base, tx_data, rx_data, len,
+                                                        &(mtb_iface->spi->context));
+    if (CY_SCB_SPI_SUCCESS != status)
+    {
+        cyhal_spi_enable_event(mtb_iface->spi, ASYNC_TRANSFER_EVENTS, CYHAL_ISR_PRIORITY_DEFAULT, false);
+        mtb_iface->async_callback = NULL;
+        return XENSIV_BGT60TRXX_STATUS_COM_ERROR;
+    }
+
+    return XENSIV_BGT60TRXX_STATUS_OK;
+}
+
+
 static inline bool pins_equal(xensiv_bgt60trxx_mtb_interrupt_pin_t ref_pin, cyhal_gpio_t pin)
 {
     #if defined(CYHAL_API_VERSION) && (CYHAL_API_VERSION >= 2)
@@ -29,6 +29,7 @@
 #include "cy_result.h"
 
 #include "xensiv_bgt60trxx.h"
+#include "xensiv_bgt60trxx_platform.h"
 
 /**
  * \addtogroup group_board_libs_mtb XENSIV(TM) BGT60TRxx Radar Sensor ModusToolBox(TM) Interface
@@ -99,6 +100,8 @@ typedef struct
     cyhal_gpio_t selpin;
     cyhal_gpio_t rstpin;
     xensiv_bgt60trxx_mtb_interrupt_pin_t irqpin;
+    xensiv_bgt60trxx_platform_callback_t async_callback; /**< Completion of the asynchronous transfer */
+    void* async_callback_arg;
 } xensiv_bgt60trxx_mtb_iface_t;
 
 
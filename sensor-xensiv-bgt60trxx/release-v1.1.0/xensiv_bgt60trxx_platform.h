@@ -96,6 +96,68 @@ int32_t xensiv_bgt60trxx_platform_spi_fifo_read(void* iface,
                                                 uint16_t* rx_data,
                                                 uint32_t len);
 
+/**
+ * @brief Callback called by the platform when an asynchronous transfer is completed.
+ *
+ * @param[in] arg Argument given when the transfer was started.
+ * @param[in] status XENSIV_BGT60TRXX_STATUS_OK if the transfer is completed without errors,
+ * otherwise XENSIV_BGT60TRXX_STATUS_COM_ERROR (transfer error or abort).
+ */
+typedef void (*xensiv_bgt60trxx_platform_callback_t)(void* arg, int32_t status);
+
+/**
+ * @brief Platform-specific function that starts a SPI write/read transfer to the register file
+ * of the sensor and returns without waiting for its end.
+ * Same transfer as \ref xensiv_bgt60trxx_platform_spi_transfer. The callback is called once the
+ * transfer is completed, typically from the SPI interrupt (a host implementation can complete the
+ * transfer from another thread). The buffers must stay valid until the callback is called.
+ * The callback can start another asynchronous transfer.
+ *
+ * @param[in] iface Platform SPI interface object.
+ * @param[in] tx_data The pointer of the buffer with data to transmit.
+ * @param[in] rx_data The pointer to the buffer to store received data.
+ * @param[in] len The number of data elements to transmit and receive.
+ * @param[in] callback Function called when the transfer is completed.
+ * @param[in] arg Argument given to the callback.
+ * @return XENSIV_BGT60TRXX_STATUS_OK if the transfer is started (the callback will be called),
+ * otherwise returns XENSIV_BGT60TRXX_STATUS_COM_ERROR (the callback will not be called).
+ */
+int32_t xensiv_bgt60trxx_platform_spi_transfer_async(void* iface,
+                                                     uint8_t* tx_data,
+                                                     uint8_t* rx_data,
+                                                     uint32_t len,
+                                                     xensiv_bgt60trxx_platform_callback_t callback,
+                                                     void* arg);
+
+/**
+ * @brief Platform-specific function that starts a SPI burst read of the sensor FIFO and returns
+ * without waiting for its end.
+ * Same transfer as \ref xensiv_bgt60trxx_platform_spi_fifo_read. The callback is called once
+ * the transfer is completed (see \ref xensiv_bgt60trxx_platform_spi_transfer_async).
+ *
+ * @param[in] iface Platform SPI interface object.
+ * @param[in] rx_data The pointer to the buffer to store the received data.
+ * @param[in] len The number of FIFO data elements of 12bits to receive.
+ * @param[in] callback Function called when the transfer is completed.
+ * @param[in] arg Argument given to the callback.
+ * @return XENSIV_BGT60TRXX_STATUS_OK if the read is started (the callback will be called),
+ * otherwise returns XENSIV_BGT60TRXX_STATUS_COM_ERROR (the callback will not be called).
+ */
+int32_t xensiv_bgt60trxx_platform_spi_fifo_read_async(void* iface,
+                                                      uint16_t* rx_data,
+                                                      uint32_t len,
+                                                      xensiv_bgt60trxx_platform_callback_t callback,
+                                                      void* arg);
+
+/**
+ * @brief Platform-specific function that aborts the asynchronous transfer in progress (if any).
+ * Its callback is called with XENSIV_BGT60TRXX_STATUS_COM_ERROR before the function returns.
+ * Used when a transfer does not complete (lost completion event, stuck bus).
+ *
+ * @param[in] iface Platform SPI interface object.
+ */
+void xensiv_bgt60trxx_platform_spi_abort_async(void* iface);
+
 /**
  * @brief Platform-specific function that waits for a specified time period in milliseconds.
  *
@@ -0,0 +1,118 @@
+/*
+ * spi_calibration.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "spi_calibration.h"
+
+#include "xensiv_bgt60trxx.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Number of different bits between two 12 bits samples
+ */
+static uint32_t count_bit_errors(uint16_t expected, uint16_t received)
+{
+	uint16_t diff = (expected ^ received) & 0x0FFFU;
+	uint32_t count = 0;
+	while (diff != 0)
+	{
+		diff &= (uint16_t)(diff - 1U);
+		count++;
+	}
+	return count;
+}
+
+/**
+ * @brief Read frames at the current clock until words_per_step test words are checked
+ */
+static void run_step(const spi_calibration_iface_t* iface, const spi_calibration_param_t* params, spi_calibration_step_t* step)
+{
+	while (step->words < params->words_per_step)
+	{
+		if (iface->read_frame(iface->context, params->buffer) != 0)
+		{
+			step->status = SPI_CALIBRATION_STEP_READ_ERROR;
+			return;
+		}
+
+		uint16_t test_word = XENSIV_BGT60TRXX_INITIAL_TEST_WORD;
+		for (uint32_t i = 0; i < params->frame_samples; i += params->antenna_count)
+		{
+			step->bit_errors += count_bit_errors(test_word, params->buffer[i]);
+			test_word = xensiv_bgt60trxx_get_next_test_word(test_word);
+			step->words++;
+		}
+	}
+
+	step->bit_error_rate = (float) step->bit_errors / (12.f * (float) step->words);
+	step->status = (step->bit_errors == 0) ? SPI_CALIBRATION_STEP_OK : SPI_CALIBRATION_STEP_BIT_ERRORS;
+}
+
+int spi_calibration_run(const spi_calibration_iface_t* iface, const spi_calibration_param_t* params, spi_calibration_result_t* result)
+{
+	if ((iface == NULL) || (iface->set_frequency == NULL) || (iface->read_frame == NULL)) return -1;
+	if ((params == NULL) || (params->frequencies == NULL) || (params->buffer == NULL)) return -1;
+	if ((params->frequency_count == 0) || (params->frequency_count > SPI_CALIBRATION_MAX_STEPS)) return -1;
+	if ((params->antenna_count == 0) || (params->frame_samples < params->antenna_count)) return -1;
+	if (result == NULL) return -1;
+
+	memset(result, 0, sizeof(spi_calibration_result_t));
+	result->step_count = params->frequency_count;
+
+	// Step the clock up until the first failure
+	int8_t last_ok = -1;
+	int8_t first_failure = -1;
+	for (uint8_t i = 0; i < params->frequency_count; ++i)
+	{
+		spi_calibration_step_t* step = &result->steps[i];
+		step->frequency = params->frequencies[i];
+		step->status = SPI_CALIBRATION_STEP_NOT_TESTED;
+
+		if (first_failure >= 0) continue;
+
+		if (iface->set_frequency(iface->context, step->frequency) != 0)
+		{
+			// Not a link failure: no margin needed below this clock
+			step->status = SPI_CALIBRATION_STEP_UNSUPPORTED;
+			break;
+		}
+
+		run_step(iface, params, step);
+		if (step->status == SPI_CALIBRATION_STEP_OK)
+		{
+			last_ok = (int8_t) i;
+		}
+		else
+		{
+			first_failure = (int8_t) i;
+		}
+	}
+
+	// Margin below the first failing clock (if the limit was reached)
+	int8_t selected = last_ok;
+	if (first_failure >= 0)
+	{
+		selected = first_failure - 1 - (int8_t) params->margin_steps;
+		if (selected > last_ok) selected = last_ok;
+
+		// The first clock is the known working one
+		if ((selected < 0) && (last_ok >= 0)) selected = 0;
+	}
+
+	if (selected < 0) return -2;
+
+	result->frequency = params->frequencies[selected];
+	return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * spi_calibration.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef SPI_CALIBRATION_H_
+#define SPI_CALIBRATION_H_
+
+#include <stdint.h>
+
+/**
+ * @def SPI_CALIBRATION_MAX_STEPS
+ * @brief Maximum number of SPI clocks tested
+ */
+#define SPI_CALIBRATION_MAX_STEPS	8
+
+/**
+ * Access to the sensor (hardware or simulated device)
+ * The sensor is in data test mode: the samples of the first antenna are the LFSR test words
+ * (xensiv_bgt60trxx_get_next_test_word), the generator restarts with each frame
+ */
+typedef struct
+{
+	/**< Change the SPI clock. Returns 0 if the clock can be generated */
+	int (*set_frequency)(void* context, uint32_t frequency);
+
+	/**< Read the beginning of a new frame (frame_samples unpacked samples). Returns 0 on success */
+	int (*read_frame)(void* context, uint16_t* samples);
+
+	void* context;
+} spi_calibration_iface_t;
+
+typedef struct
+{
+	const uint32_t* frequencies;	/**< SPI clocks tested, ascending. The first one must work */
+	uint8_t frequency_count;		/**< <= SPI_CALIBRATION_MAX_STEPS */
+
+	uint32_t words_per_step;		/**< Minimum number of test words checked per clock (several frames are read) */
+	uint16_t* buffer;				/**< frame_samples samples */
+	uint32_t frame_samples;
+	uint8_t antenna_count;			/**< Samples are interleaved, only the first antenna holds the test words */
+
+	uint8_t margin_steps;			/**< Steps kept between the selected clock and the first clock with errors */
+} spi_calibration_param_t;
+
+typedef enum
+{
+	SPI_CALIBRATION_STEP_OK = 0,
+	SPI_CALIBRATION_STEP_BIT_ERRORS,		/**< Test words received with errors */
+	SPI_CALIBRATION_STEP_READ_ERROR,		/**< FIFO read failed (GSR0 error, SPI error) */
+	SPI_CALIBRATION_STEP_UNSUPPORTED,		/**< Clock cannot be generated */
+	SPI_CALIBRATION_STEP_NOT_TESTED,		/**< Above the first failing clock */
+} spi_calibration_step_status_t;
+
+typedef struct
+{
+	uint32_t frequency;
+	spi_calibration_step_status_t status;
+	uint32_t words;				/**< Test words checked */
+	uint32_t bit_errors;		/**< Wrong bits (12 bits per word) */
+	float bit_error_rate;		/**< bit_errors / (12 * words) */
+} spi_calibration_step_t;
+
+typedef struct
+{
+	spi_calibration_step_t steps[SPI_CALIBRATION_MAX_STEPS];
+	uint8_t step_count;
+	uint32_t frequency;			/**< Selected clock */
+} spi_calibration_result_t;
+
+/**
+ * @brief Step the SPI clock up, check the test words received at each clock and select
+ * the fastest error-free clock (margin_steps below the first failing clock)
+ * Stops at the first failing clock. The selected clock is not applied
+ *
+ * @retval 0 Success
+ * @retval -1 Invalid parameters
+ * @retval -2 No error-free clock (result->frequency is 0)
+ */
+int spi_calibration_run(const spi_calibration_iface_t* iface, const spi_calibration_param_t* params, spi_calibration_result_t* result);
+
+#endif /* SPI_CALIBRATION_H_ */
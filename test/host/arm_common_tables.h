@@ -0,0 +1,47 @@
+/*
+ * arm_common_tables.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: the host FFTs only use the lengths of the plans, the tables are placeholders
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_HOST_ARM_COMMON_TABLES_H_
+#define TEST_HOST_ARM_COMMON_TABLES_H_
+
+#include "ifx_sensor_dsp.h"
+
+#define HOST_FFT_TABLES(N) \
+	extern const float32_t twiddleCoef_##N[]; \
+	extern const uint16_t armBitRevIndexTable##N[]; \
+	extern const float32_t twiddleCoef_rfft_##N[];
+
+HOST_FFT_TABLES(16)
+HOST_FFT_TABLES(32)
+HOST_FFT_TABLES(64)
+HOST_FFT_TABLES(128)
+HOST_FFT_TABLES(256)
+HOST_FFT_TABLES(512)
+HOST_FFT_TABLES(1024)
+HOST_FFT_TABLES(2048)
+HOST_FFT_TABLES(4096)
+
+#define ARMBITREVINDEXTABLE_16_TABLE_LENGTH		20
+#define ARMBITREVINDEXTABLE_32_TABLE_LENGTH		48
+#define ARMBITREVINDEXTABLE_64_TABLE_LENGTH		56
+#define ARMBITREVINDEXTABLE_128_TABLE_LENGTH	208
+#define ARMBITREVINDEXTABLE_256_TABLE_LENGTH	440
+#define ARMBITREVINDEXTABLE_512_TABLE_LENGTH	448
+#define ARMBITREVINDEXTABLE_1024_TABLE_LENGTH	1800
+#define ARMBITREVINDEXTABLE_2048_TABLE_LENGTH	3808
+#define ARMBITREVINDEXTABLE_4096_TABLE_LENGTH	4032
+
+#endif /* TEST_HOST_ARM_COMMON_TABLES_H_ */
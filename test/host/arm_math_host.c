@@ -0,0 +1,472 @@
+/*
+ * arm_math_host.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: reference implementation (double precision) of the CMSIS-DSP and sensor-dsp
+ * functions used by the firmware. The scaling conventions are the ones of CMSIS-DSP:
+ * - arm_rfft_fast_f32: not scaled, output packed as [Re(0), Re(N/2), Re(1), Im(1), ...]
+ * - arm_rfft_q15: complete spectrum (2 * N values) scaled down by N / 2 (7.9 format for 128 points)
+ * - arm_cfft_q31: scaled down by N (5.27 format for 16 points)
+ * - arm_cmplx_mag_q31: 1.31 input, 2.30 output
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "ifx_sensor_dsp.h"
+#include "arm_common_tables.h"
+#include "arm_const_structs.h"
+
+#include <string.h>
+
+#define HOST_FFT_MAX_LEN	8192
+
+/**
+ * Placeholders of the CMSIS tables (the host FFTs only use the lengths)
+ */
+#define HOST_FFT_TABLES_DEFINE(N) \
+	const float32_t twiddleCoef_##N[1] = { 0 }; \
+	const uint16_t armBitRevIndexTable##N[1] = { 0 }; \
+	const float32_t twiddleCoef_rfft_##N[1] = { 0 };
+
+HOST_FFT_TABLES_DEFINE(16)
+HOST_FFT_TABLES_DEFINE(32)
+HOST_FFT_TABLES_DEFINE(64)
+HOST_FFT_TABLES_DEFINE(128)
+HOST_FFT_TABLES_DEFINE(256)
+HOST_FFT_TABLES_DEFINE(512)
+HOST_FFT_TABLES_DEFINE(1024)
+HOST_FFT_TABLES_DEFINE(2048)
+HOST_FFT_TABLES_DEFINE(4096)
+
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len16 = { 16, twiddleCoef_16, armBitRevIndexTable16, ARMBITREVINDEXTABLE_16_TABLE_LENGTH };
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len32 = { 32, twiddleCoef_32, armBitRevIndexTable32, ARMBITREVINDEXTABLE_32_TABLE_LENGTH };
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len64 = { 64, twiddleCoef_64, armBitRevIndexTable64, ARMBITREVINDEXTABLE_64_TABLE_LENGTH };
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len128 = { 128, twiddleCoef_128, armBitRevIndexTable128, ARMBITREVINDEXTABLE_128_TABLE_LENGTH };
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len256 = { 256, twiddleCoef_256, armBitRevIndexTable256, ARMBITREVINDEXTABLE_256_TABLE_LENGTH };
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len512 = { 512, twiddleCoef_512, armBitRevIndexTable512, ARMBITREVINDEXTABLE_512_TABLE_LENGTH };
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024 = { 1024, twiddleCoef_1024, armBitRevIndexTable1024, ARMBITREVINDEXTABLE_1024_TABLE_LENGTH };
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048 = { 2048, twiddleCoef_2048, armBitRevIndexTable2048, ARMBITREVINDEXTABLE_2048_TABLE_LENGTH };
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096 = { 4096, twiddleCoef_4096, armBitRevIndexTable4096, ARMBITREVINDEXTABLE_4096_TABLE_LENGTH };
+
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len16 = { 16, NULL, NULL, 0 };
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len32 = { 32, NULL, NULL, 0 };
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len64 = { 64, NULL, NULL, 0 };
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 = { 128, NULL, NULL, 0 };
+const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 = { 256, NULL, NULL, 0 };
+
+static double fft_re[HOST_FFT_MAX_LEN];
+static double fft_im[HOST_FFT_MAX_LEN];
+
+static bool is_power_of_two(uint32_t len, uint32_t min, uint32_t max)
+{
+	return (len >= min) && (len <= max) && ((len & (len - 1)) == 0);
+}
+
+/**
+ * @brief In place radix-2 FFT of fft_re / fft_im (not scaled)
+ */
+static void fft(uint32_t len, bool inverse)
+{
+	for(uint32_t i = 1, j = 0; i < len; ++i)
+	{
+		uint32_t bit = len >> 1;
+		for(; j & bit; bit >>= 1)
+		{
+			j ^= bit;
+		}
+		j ^= bit;
+
+		if (i < j)
+		{
+			double tmp = fft_re[i]; fft_re[i] = fft_re[j]; fft_re[j] = tmp;
+			tmp = fft_im[i]; fft_im[i] = fft_im[j]; fft_im[j] = tmp;
+		}
+	}
+
+	for(uint32_t size = 2; size <= len; size <<= 1)
+	{
+		const double angle = (inverse ? 2.0 : -2.0) * M_PI / (double) size;
+		for(uint32_t start = 0; start < len; start += size)
+		{
+			for(uint32_t k = 0; k < size / 2; ++k)
+			{
+				const double wr = cos(angle * k);
+				const double wi = sin(angle * k);
+				const uint32_t a = start + k;
+				const uint32_t b = a + size / 2;
+				const double tr = fft_re[b] * wr - fft_im[b] * wi;
+				const double ti = fft_re[b] * wi + fft_im[b] * wr;
+				fft_re[b] = fft_re[a] - tr;
+				fft_im[b] = fft_im[a] - ti;
+				fft_re[a] += tr;
+				fft_im[a] += ti;
+			}
+		}
+	}
+}
+
+static q31_t saturate_q31(double value)
+{
+	value = round(value);
+	if (value > 2147483647.0) return INT32_MAX;
+	if (value < -2147483648.0) return INT32_MIN;
+	return (q31_t) value;
+}
+
+static q15_t saturate_q15(double value)
+{
+	value = round(value);
+	if (value > 32767.0) return INT16_MAX;
+	if (value < -32768.0) return INT16_MIN;
+	return (q15_t) value;
+}
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32* S, uint16_t fftLen)
+{
+	if (!is_power_of_two(fftLen, 32, 4096)) return ARM_MATH_ARGUMENT_ERROR;
+
+	S->Sint.fftLen = fftLen / 2;
+	S->Sint.pTwiddle = NULL;
+	S->Sint.pBitRevTable = NULL;
+	S->Sint.bitRevLength = 0;
+	S->fftLenRFFT = fftLen;
+	S->pTwiddleRFFT = NULL;
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32* S, float32_t* p, float32_t* pOut, uint8_t ifftFlag)
+{
+	const uint32_t len = S->fftLenRFFT;
+
+	if (ifftFlag == 0)
+	{
+		for(uint32_t i = 0; i < len; ++i)
+		{
+			fft_re[i] = p[i];
+			fft_im[i] = 0;
+		}
+		fft(len, false);
+
+		pOut[0] = (float32_t) fft_re[0];
+		pOut[1] = (float32_t) fft_re[len / 2];
+		for(uint32_t k = 1; k < len / 2; ++k)
+		{
+			pOut[2 * k] = (float32_t) fft_re[k];
+			pOut[2 * k + 1] = (float32_t) fft_im[k];
+		}
+		return;
+	}
+
+	// Inverse: packed half spectrum -> real signal (scaled by 1 / N)
+	fft_re[0] = p[0];
+	fft_im[0] = 0;
+	fft_re[len / 2] = p[1];
+	fft_im[len / 2] = 0;
+	for(uint32_t k = 1; k < len / 2; ++k)
+	{
+		fft_re[k] = p[2 * k];
+		fft_im[k] = p[2 * k + 1];
+		fft_re[len - k] = p[2 * k];
+		fft_im[len - k] = -p[2 * k + 1];
+	}
+	fft(len, true);
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		pOut[i] = (float32_t)(fft_re[i] / (double) len);
+	}
+}
+
+arm_status arm_cfft_init_f32(arm_cfft_instance_f32* S, uint16_t fftLen)
+{
+	if (!is_power_of_two(fftLen, 16, 4096)) return ARM_MATH_ARGUMENT_ERROR;
+
+	S->fftLen = fftLen;
+	S->pTwiddle = NULL;
+	S->pBitRevTable = NULL;
+	S->bitRevLength = 0;
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_cfft_f32(const arm_cfft_instance_f32* S, float32_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+	(void) bitReverseFlag;
+	const uint32_t len = S->fftLen;
+
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		fft_re[i] = p1[2 * i];
+		fft_im[i] = p1[2 * i + 1];
+	}
+	fft(len, ifftFlag != 0);
+
+	const double scale = (ifftFlag != 0) ? (1.0 / (double) len) : 1.0;
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		p1[2 * i] = (float32_t)(fft_re[i] * scale);
+		p1[2 * i + 1] = (float32_t)(fft_im[i] * scale);
+	}
+}
+
+arm_status arm_cfft_init_q31(arm_cfft_instance_q31* S, uint16_t fftLen)
+{
+	if (!is_power_of_two(fftLen, 16, 4096)) return ARM_MATH_ARGUMENT_ERROR;
+
+	S->fftLen = fftLen;
+	S->pTwiddle = NULL;
+	S->pBitRevTable = NULL;
+	S->bitRevLength = 0;
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_cfft_q31(const arm_cfft_instance_q31* S, q31_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+	(void) bitReverseFlag;
+	const uint32_t len = S->fftLen;
+
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		fft_re[i] = p1[2 * i];
+		fft_im[i] = p1[2 * i + 1];
+	}
+	fft(len, ifftFlag != 0);
+
+	// Forward and inverse are both scaled down by N
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		p1[2 * i] = saturate_q31(fft_re[i] / (double) len);
+		p1[2 * i + 1] = saturate_q31(fft_im[i] / (double) len);
+	}
+}
+
+arm_status arm_rfft_init_q15(arm_rfft_instance_q15* S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag)
+{
+	if (!is_power_of_two(fftLenReal, 32, 8192)) return ARM_MATH_ARGUMENT_ERROR;
+
+	memset(S, 0, sizeof(arm_rfft_instance_q15));
+	S->fftLenReal = fftLenReal;
+	S->ifftFlagR = (uint8_t) ifftFlagR;
+	S->bitReverseFlagR = (uint8_t) bitReverseFlag;
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_rfft_q15(const arm_rfft_instance_q15* S, q15_t* pSrc, q15_t* pDst)
+{
+	const uint32_t len = S->fftLenReal;
+
+	// Only the forward transform is used by the firmware
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		fft_re[i] = pSrc[i];
+		fft_im[i] = 0;
+	}
+	fft(len, false);
+
+	const double scale = 2.0 / (double) len;
+	for(uint32_t k = 0; k < len; ++k)
+	{
+		pDst[2 * k] = saturate_q15(fft_re[k] * scale);
+		pDst[2 * k + 1] = saturate_q15(fft_im[k] * scale);
+	}
+}
+
+void arm_mult_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize)
+{
+	for(uint32_t i = 0; i < blockSize; ++i)
+	{
+		pDst[i] = pSrcA[i] * pSrcB[i];
+	}
+}
+
+void arm_mult_q15(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+	for(uint32_t i = 0; i < blockSize; ++i)
+	{
+		const int32_t product = ((int32_t) pSrcA[i] * pSrcB[i]) >> 15;
+		pDst[i] = (product > INT16_MAX) ? INT16_MAX : (q15_t) product;
+	}
+}
+
+void arm_scale_f32(const float32_t* pSrc, float32_t scale, float32_t* pDst, uint32_t blockSize)
+{
+	for(uint32_t i = 0; i < blockSize; ++i)
+	{
+		pDst[i] = pSrc[i] * scale;
+	}
+}
+
+void arm_offset_q15(const q15_t* pSrc, q15_t offset, q15_t* pDst, uint32_t blockSize)
+{
+	for(uint32_t i = 0; i < blockSize; ++i)
+	{
+		pDst[i] = saturate_q15((double) pSrc[i] + offset);
+	}
+}
+
+void arm_mean_q15(const q15_t* pSrc, uint32_t blockSize, q15_t* pResult)
+{
+	int32_t sum = 0;
+	for(uint32_t i = 0; i < blockSize; ++i)
+	{
+		sum += pSrc[i];
+	}
+	*pResult = (q15_t)(sum / (int32_t) blockSize);
+}
+
+void arm_cmplx_mult_real_f32(const float32_t* pSrcCmplx, const float32_t* pSrcReal, float32_t* pCmplxDst, uint32_t numSamples)
+{
+	for(uint32_t i = 0; i < numSamples; ++i)
+	{
+		pCmplxDst[2 * i] = pSrcCmplx[2 * i] * pSrcReal[i];
+		pCmplxDst[2 * i + 1] = pSrcCmplx[2 * i + 1] * pSrcReal[i];
+	}
+}
+
+void arm_cmplx_mag_q31(const q31_t* pSrc, q31_t* pDst, uint32_t numSamples)
+{
+	for(uint32_t i = 0; i < numSamples; ++i)
+	{
+		const double re = pSrc[2 * i];
+		const double im = pSrc[2 * i + 1];
+		pDst[i] = saturate_q31(sqrt(re * re + im * im) / 2.0);
+	}
+}
+
+arm_status arm_sqrt_f32(float32_t in, float32_t* pOut)
+{
+	if (in < 0)
+	{
+		*pOut = 0;
+		return ARM_MATH_ARGUMENT_ERROR;
+	}
+	*pOut = sqrtf(in);
+	return ARM_MATH_SUCCESS;
+}
+
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32* S, uint8_t numStages, const float32_t* pCoeffs, float32_t* pState)
+{
+	S->numStages = numStages;
+	S->pCoeffs = pCoeffs;
+	S->pState = pState;
+	memset(pState, 0, 4 * numStages * sizeof(float32_t));
+}
+
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32* S, const float32_t* pSrc, float32_t* pDst, uint32_t blockSize)
+{
+	for(uint32_t n = 0; n < blockSize; ++n)
+	{
+		float32_t value = pSrc[n];
+		for(uint32_t stage = 0; stage < S->numStages; ++stage)
+		{
+			const float32_t* b = &S->pCoeffs[5 * stage];
+			float32_t* state = &S->pState[4 * stage];	// x[n-1], x[n-2], y[n-1], y[n-2]
+			const float32_t out = b[0] * value + b[1] * state[0] + b[2] * state[1] + b[3] * state[2] + b[4] * state[3];
+			state[1] = state[0];
+			state[0] = value;
+			state[3] = state[2];
+			state[2] = out;
+			value = out;
+		}
+		pDst[n] = value;
+	}
+}
+
+void ifx_mean_removal_f32(float32_t* data, uint32_t len)
+{
+	double sum = 0;
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		sum += data[i];
+	}
+	const float32_t mean = (float32_t)(sum / (double) len);
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		data[i] -= mean;
+	}
+}
+
+void ifx_cmplx_mean_removal_f32(cfloat32_t* data, uint32_t len)
+{
+	double sum_real = 0, sum_imag = 0;
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		sum_real += CREAL_F32(data[i]);
+		sum_imag += CIMAG_F32(data[i]);
+	}
+	const float32_t mean_real = (float32_t)(sum_real / (double) len);
+	const float32_t mean_imag = (float32_t)(sum_imag / (double) len);
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		CREAL_F32(data[i]) -= mean_real;
+		CIMAG_F32(data[i]) -= mean_imag;
+	}
+}
+
+/**
+ * @brief Symmetric window a0 - a1 cos(x) + a2 cos(2x) - a3 cos(3x)
+ */
+static void cosine_window(float32_t* win, uint32_t len, double a0, double a1, double a2, double a3)
+{
+	for(uint32_t i = 0; i < len; ++i)
+	{
+		const double x = (len > 1) ? (2.0 * M_PI * i / (double)(len - 1)) : 0;
+		win[i] = (float32_t)(a0 - a1 * cos(x) + a2 * cos(2 * x) - a3 * cos(3 * x));
+	}
+}
+
+void ifx_window_hann_f32(float32_t* win, uint32_t len)
+{
+	cosine_window(win, len, 0.5, 0.5, 0, 0);
+}
+
+void ifx_window_hamming_f32(float32_t* win, uint32_t len)
+{
+	cosine_window(win, len, 0.54, 0.46, 0, 0);
+}
+
+void ifx_window_blackmanharris_f32(float32_t* win, uint32_t len)
+{
+	cosine_window(win, len, 0.35875, 0.48829, 0.14128, 0.01168);
+}
+
+/**
+ * @brief Chebyshev polynomial of the given order
+ */
+static double chebyshev_polynomial(uint32_t order, double x)
+{
+	if (fabs(x) <= 1) return cos(order * acos(x));
+	if (x > 1) return cosh(order * acosh(x));
+	return ((order % 2) ? -1.0 : 1.0) * cosh(order * acosh(-x));
+}
+
+void ifx_window_chebyshev_f32(float32_t* win, uint32_t len, float32_t attenuation_db)
+{
+	// Dolph-Chebyshev: inverse DFT of the Chebyshev polynomial sampled on the unit circle
+	const uint32_t order = len - 1;
+	const double beta = cosh(acosh(pow(10.0, attenuation_db / 20.0)) / (double) order);
+
+	double max = 0;
+	for(uint32_t n = 0; n < len; ++n)
+	{
+		double sum = 0;
+		for(uint32_t k = 0; k < len; ++k)
+		{
+			const double value = chebyshev_polynomial(order, beta * cos(M_PI * k / (double) len));
+			const double phase = 2.0 * M_PI * k * ((double) n - (double) order / 2.0) / (double) len;
+			sum += value * cos(phase);
+		}
+		win[n] = (float32_t) sum;
+		if (fabs(sum) > max) max = fabs(sum);
+	}
+
+	for(uint32_t n = 0; n < len; ++n)
+	{
+		win[n] = (float32_t)(win[n] / max);
+	}
+}
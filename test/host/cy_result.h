@@ -0,0 +1,36 @@
+/*
+ * cy_result.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: result type of the ModusToolbox libraries
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_HOST_CY_RESULT_H_
+#define TEST_HOST_CY_RESULT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS						((cy_rslt_t)0x00000000U)
+#define CY_RSLT_TYPE_ERROR					(2U)
+
+/**
+ * Same layout as the ModusToolbox result: type (bits 16-17), module (bits 18-31), code (bits 0-15)
+ */
+#define CY_RSLT_CREATE(type, module, code)	((((module) & 0x3FFFU) << 18U) | (((code) & 0xFFFFU) << 0U) | (((type) & 0x3U) << 16U))
+
+#define CY_UNUSED_PARAMETER(x)				((void)(x))
+
+#endif /* TEST_HOST_CY_RESULT_H_ */
@@ -0,0 +1,35 @@
+/*
+ * cycfg_pins.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: pins of the Arduino header used by the firmware
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_HOST_CYCFG_PINS_H_
+#define TEST_HOST_CYCFG_PINS_H_
+
+#include "cyhal_gpio.h"
+
+enum
+{
+	ARDU_MOSI = 0,
+	ARDU_MISO,
+	ARDU_CLK,
+	ARDU_CS,
+	ARDU_IO3,
+	ARDU_IO4,
+	ARDU_IO6,
+	ARDU_IO7,
+	CYCFG_PIN_COUNT,
+};
+
+#endif /* TEST_HOST_CYCFG_PINS_H_ */
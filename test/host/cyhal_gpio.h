@@ -0,0 +1,78 @@
+/*
+ * cyhal_gpio.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: GPIO functions of the HAL (cyhal_host.c)
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_HOST_CYHAL_GPIO_H_
+#define TEST_HOST_CYHAL_GPIO_H_
+
+#include "cy_result.h"
+
+#define CYHAL_API_VERSION					2
+
+#define CYHAL_ISR_PRIORITY_DEFAULT			7
+
+typedef int cyhal_gpio_t;
+
+#define NC									((cyhal_gpio_t)-1)
+
+typedef enum
+{
+	CYHAL_GPIO_DIR_INPUT,
+	CYHAL_GPIO_DIR_OUTPUT,
+	CYHAL_GPIO_DIR_BIDIRECTIONAL,
+} cyhal_gpio_direction_t;
+
+typedef enum
+{
+	CYHAL_GPIO_DRIVE_NONE,
+	CYHAL_GPIO_DRIVE_ANALOG,
+	CYHAL_GPIO_DRIVE_PULLUP,
+	CYHAL_GPIO_DRIVE_PULLDOWN,
+	CYHAL_GPIO_DRIVE_OPENDRAINDRIVESLOW,
+	CYHAL_GPIO_DRIVE_OPENDRAINDRIVESHIGH,
+	CYHAL_GPIO_DRIVE_STRONG,
+	CYHAL_GPIO_DRIVE_PULLUPDOWN,
+} cyhal_gpio_drive_mode_t;
+
+typedef enum
+{
+	CYHAL_GPIO_IRQ_NONE = 0,
+	CYHAL_GPIO_IRQ_RISE = 1,
+	CYHAL_GPIO_IRQ_FALL = 2,
+	CYHAL_GPIO_IRQ_BOTH = 3,
+} cyhal_gpio_event_t;
+
+typedef void (*cyhal_gpio_event_callback_t)(void* callback_arg, cyhal_gpio_event_t event);
+
+typedef struct
+{
+	cyhal_gpio_event_callback_t callback;
+	void* callback_arg;
+	void* next;
+	cyhal_gpio_t pin;
+} cyhal_gpio_callback_data_t;
+
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction, cyhal_gpio_drive_mode_t drive_mode, bool init_val);
+
+void cyhal_gpio_free(cyhal_gpio_t pin);
+
+void cyhal_gpio_write(cyhal_gpio_t pin, bool value);
+
+/**
+ * @brief Level of an output, the IRQ pin of the sensor reads the IRQ line of the simulated sensor
+ */
+bool cyhal_gpio_read(cyhal_gpio_t pin);
+
+#endif /* TEST_HOST_CYHAL_GPIO_H_ */
@@ -0,0 +1,203 @@
+/*
+ * cyhal_host.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: the HAL functions, hal_timer and the ModusToolbox layer of the sensor driver
+ * used by bgt60trxxx.c, on top of the simulated sensor (sensor_sim.c)
+ * - The delays let the simulated time pass, the interrupts (FIFO IRQ edge, end of the asynchronous SPI
+ *   transfers) are called meanwhile from the calling thread, as on the MCU
+ * - hal_timer counts the simulated microseconds
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "cyhal_gpio.h"
+#include "cyhal_spi.h"
+#include "cyhal_system.h"
+#include "cycfg_pins.h"
+
+#include "xensiv_bgt60trxx_mtb.h"
+#include "hal_timer.h"
+#include "sensor_sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool pin_levels[CYCFG_PIN_COUNT];
+
+/**
+ * Nesting of the critical sections: no time passes inside
+ */
+static uint32_t critical_sections = 0;
+
+/**
+ * FIFO interrupt registered by xensiv_bgt60trxx_mtb_interrupt_init
+ */
+static cyhal_gpio_t irq_pin = NC;
+static cyhal_gpio_event_callback_t irq_callback = NULL;
+static void* irq_callback_arg = NULL;
+
+static void host_assert(bool condition, const char* message)
+{
+	if (!condition)
+	{
+		printf("cyhal_host: %s\n", message);
+		abort();
+	}
+}
+
+static void irq_rising_edge(void)
+{
+	if (irq_callback != NULL)
+	{
+		irq_callback(irq_callback_arg, CYHAL_GPIO_IRQ_RISE);
+	}
+}
+
+static void advance_us(uint64_t us)
+{
+	host_assert(critical_sections == 0, "delay inside a critical section");
+	sensor_sim_advance(us * 1000ULL);
+}
+
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction, cyhal_gpio_drive_mode_t drive_mode, bool init_val)
+{
+	CY_UNUSED_PARAMETER(direction);
+	CY_UNUSED_PARAMETER(drive_mode);
+
+	if ((pin < 0) || (pin >= CYCFG_PIN_COUNT)) return CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0, 1);
+	pin_levels[pin] = init_val;
+	return CY_RSLT_SUCCESS;
+}
+
+void cyhal_gpio_free(cyhal_gpio_t pin)
+{
+	CY_UNUSED_PARAMETER(pin);
+}
+
+void cyhal_gpio_write(cyhal_gpio_t pin, bool value)
+{
+	if ((pin >= 0) && (pin < CYCFG_PIN_COUNT))
+	{
+		pin_levels[pin] = value;
+	}
+}
+
+bool cyhal_gpio_read(cyhal_gpio_t pin)
+{
+	if ((pin != NC) && (pin == irq_pin)) return sensor_sim_get_irq();
+	return ((pin >= 0) && (pin < CYCFG_PIN_COUNT)) ? pin_levels[pin] : false;
+}
+
+cy_rslt_t cyhal_spi_init(cyhal_spi_t* obj, cyhal_gpio_t mosi, cyhal_gpio_t miso, cyhal_gpio_t sclk, cyhal_gpio_t ssel,
+		const void* clk, uint8_t bits, cyhal_spi_mode_t mode, bool is_slave)
+{
+	CY_UNUSED_PARAMETER(mosi);
+	CY_UNUSED_PARAMETER(miso);
+	CY_UNUSED_PARAMETER(sclk);
+	CY_UNUSED_PARAMETER(ssel);
+	CY_UNUSED_PARAMETER(clk);
+	CY_UNUSED_PARAMETER(bits);
+	CY_UNUSED_PARAMETER(mode);
+	CY_UNUSED_PARAMETER(is_slave);
+
+	obj->frequency = 0;
+	return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_spi_set_frequency(cyhal_spi_t* obj, uint32_t hz)
+{
+	if (hz == 0) return CY_RSLT_CREATE(CY_RSLT_TYPE_ERROR, 0, 1);
+
+	obj->frequency = hz;
+	sensor_sim_set_spi_frequency(hz);
+	return CY_RSLT_SUCCESS;
+}
+
+uint32_t cyhal_system_critical_section_enter(void)
+{
+	critical_sections++;
+	return 0;
+}
+
+void cyhal_system_critical_section_exit(uint32_t old_state)
+{
+	CY_UNUSED_PARAMETER(old_state);
+
+	host_assert(critical_sections > 0, "critical section exit without enter");
+	critical_sections--;
+}
+
+void CyDelay(uint32_t milliseconds)
+{
+	advance_us((uint64_t) milliseconds * 1000U);
+}
+
+void CyDelayUs(uint16_t microseconds)
+{
+	advance_us(microseconds);
+}
+
+int hal_timer_init()
+{
+	return 0;
+}
+
+uint32_t hal_timer_get_uticks(void)
+{
+	return (uint32_t)(sensor_sim_get_time_ns() / 1000U);
+}
+
+cy_rslt_t xensiv_bgt60trxx_mtb_init(xensiv_bgt60trxx_mtb_t* obj,
+                                    cyhal_spi_t* spi,
+                                    cyhal_gpio_t selpin,
+                                    cyhal_gpio_t rstpin,
+                                    const uint32_t* regs,
+                                    size_t len)
+{
+	obj->iface.spi = spi;
+	obj->iface.selpin = selpin;
+	obj->iface.rstpin = rstpin;
+	obj->iface.async_callback = NULL;
+
+	// Hard reset, then the same initialization as the ModusToolbox layer on the simulated sensor
+	void* iface = sensor_sim_get_iface();
+	xensiv_bgt60trxx_platform_rst_set(iface, false);
+	xensiv_bgt60trxx_platform_rst_set(iface, true);
+	xensiv_bgt60trxx_platform_spi_cs_set(iface, true);
+
+	if (xensiv_bgt60trxx_init(&obj->dev, iface, false) != XENSIV_BGT60TRXX_STATUS_OK) return XENSIV_BGT60TRXX_RSLT_ERR_COMM;
+	if (xensiv_bgt60trxx_config(&obj->dev, regs, len) != XENSIV_BGT60TRXX_STATUS_OK) return XENSIV_BGT60TRXX_RSLT_ERR_COMM;
+	return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t xensiv_bgt60trxx_mtb_interrupt_init(xensiv_bgt60trxx_mtb_t* obj,
+                                              uint16_t fifo_limit,
+                                              cyhal_gpio_t irqpin,
+                                              uint8_t intr_priority,
+                                              cyhal_gpio_event_callback_t callback,
+                                              void* callback_arg)
+{
+	CY_UNUSED_PARAMETER(intr_priority);
+
+	if ((irq_pin != NC) && (irq_pin != irqpin)) return XENSIV_BGT60TRXX_RSLT_ERR_INTPIN_INUSE;
+
+	// Rising edge of the IRQ line
+	obj->iface.irqpin.pin = irqpin;
+	obj->iface.irqpin.callback = callback;
+	obj->iface.irqpin.callback_arg = callback_arg;
+	irq_pin = irqpin;
+	irq_callback = callback;
+	irq_callback_arg = callback_arg;
+	sensor_sim_set_irq_callback(irq_rising_edge);
+
+	if (xensiv_bgt60trxx_set_fifo_limit(&obj->dev, fifo_limit) != XENSIV_BGT60TRXX_STATUS_OK) return XENSIV_BGT60TRXX_RSLT_ERR_COMM;
+	return CY_RSLT_SUCCESS;
+}
@@ -0,0 +1,43 @@
+/*
+ * cyhal_spi.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: SPI functions of the HAL (cyhal_host.c), the transfers are done by the simulated sensor
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_HOST_CYHAL_SPI_H_
+#define TEST_HOST_CYHAL_SPI_H_
+
+#include "cyhal_gpio.h"
+
+typedef enum
+{
+	CYHAL_SPI_MODE_00_MSB,
+	CYHAL_SPI_MODE_01_MSB,
+	CYHAL_SPI_MODE_10_MSB,
+	CYHAL_SPI_MODE_11_MSB,
+} cyhal_spi_mode_t;
+
+typedef struct
+{
+	uint32_t frequency;
+} cyhal_spi_t;
+
+cy_rslt_t cyhal_spi_init(cyhal_spi_t* obj, cyhal_gpio_t mosi, cyhal_gpio_t miso, cyhal_gpio_t sclk, cyhal_gpio_t ssel,
+		const void* clk, uint8_t bits, cyhal_spi_mode_t mode, bool is_slave);
+
+/**
+ * @brief Clock of the simulated bus (sensor_sim_set_spi_frequency)
+ */
+cy_rslt_t cyhal_spi_set_frequency(cyhal_spi_t* obj, uint32_t hz);
+
+#endif /* TEST_HOST_CYHAL_SPI_H_ */
@@ -0,0 +1,31 @@
+/*
+ * cyhal_system.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: critical sections and delays (cyhal_host.c)
+ * The delays let the simulated time pass: the interrupts of the simulated sensor occur meanwhile
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_HOST_CYHAL_SYSTEM_H_
+#define TEST_HOST_CYHAL_SYSTEM_H_
+
+#include "cy_result.h"
+
+uint32_t cyhal_system_critical_section_enter(void);
+
+void cyhal_system_critical_section_exit(uint32_t old_state);
+
+void CyDelay(uint32_t milliseconds);
+
+void CyDelayUs(uint16_t microseconds);
+
+#endif /* TEST_HOST_CYHAL_SYSTEM_H_ */
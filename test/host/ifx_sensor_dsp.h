@@ -0,0 +1,129 @@
+/*
+ * ifx_sensor_dsp.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: subset of CMSIS-DSP and sensor-dsp used by the firmware,
+ * same types and same scaling conventions (see arm_math_host.c)
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_HOST_IFX_SENSOR_DSP_H_
+#define TEST_HOST_IFX_SENSOR_DSP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <math.h>
+
+typedef float float32_t;
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef int64_t q63_t;
+
+typedef struct
+{
+	float32_t data[2];
+} cfloat32_t;
+
+#define CREAL_F32(x)	((x).data[0])
+#define CIMAG_F32(x)	((x).data[1])
+
+#ifndef PI
+#define PI				3.14159265358979f
+#endif
+
+typedef enum
+{
+	ARM_MATH_SUCCESS = 0,
+	ARM_MATH_ARGUMENT_ERROR = -1,
+} arm_status;
+
+#define IFX_SENSOR_DSP_STATUS_OK		0
+#define IFX_SENSOR_DSP_ARGUMENT_ERROR	1
+
+typedef struct
+{
+	uint16_t fftLen;
+	const float32_t* pTwiddle;
+	const uint16_t* pBitRevTable;
+	uint16_t bitRevLength;
+} arm_cfft_instance_f32;
+
+typedef struct
+{
+	arm_cfft_instance_f32 Sint;
+	uint16_t fftLenRFFT;
+	const float32_t* pTwiddleRFFT;
+} arm_rfft_fast_instance_f32;
+
+typedef struct
+{
+	uint16_t fftLen;
+	const q31_t* pTwiddle;
+	const uint16_t* pBitRevTable;
+	uint16_t bitRevLength;
+} arm_cfft_instance_q31;
+
+typedef struct
+{
+	uint16_t fftLen;
+	const q15_t* pTwiddle;
+	const uint16_t* pBitRevTable;
+	uint16_t bitRevLength;
+} arm_cfft_instance_q15;
+
+typedef struct
+{
+	uint32_t fftLenReal;
+	uint8_t ifftFlagR;
+	uint8_t bitReverseFlagR;
+	uint32_t twidCoefRModifier;
+	const q15_t* pTwiddleAReal;
+	const q15_t* pTwiddleBReal;
+	const arm_cfft_instance_q15* pCfft;
+} arm_rfft_instance_q15;
+
+typedef struct
+{
+	uint32_t numStages;
+	float32_t* pState;
+	const float32_t* pCoeffs;
+} arm_biquad_casd_df1_inst_f32;
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32* S, uint16_t fftLen);
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32* S, float32_t* p, float32_t* pOut, uint8_t ifftFlag);
+arm_status arm_cfft_init_f32(arm_cfft_instance_f32* S, uint16_t fftLen);
+void arm_cfft_f32(const arm_cfft_instance_f32* S, float32_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+arm_status arm_cfft_init_q31(arm_cfft_instance_q31* S, uint16_t fftLen);
+void arm_cfft_q31(const arm_cfft_instance_q31* S, q31_t* p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+arm_status arm_rfft_init_q15(arm_rfft_instance_q15* S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag);
+void arm_rfft_q15(const arm_rfft_instance_q15* S, q15_t* pSrc, q15_t* pDst);
+
+void arm_mult_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t blockSize);
+void arm_mult_q15(const q15_t* pSrcA, const q15_t* pSrcB, q15_t* pDst, uint32_t blockSize);
+void arm_scale_f32(const float32_t* pSrc, float32_t scale, float32_t* pDst, uint32_t blockSize);
+void arm_offset_q15(const q15_t* pSrc, q15_t offset, q15_t* pDst, uint32_t blockSize);
+void arm_mean_q15(const q15_t* pSrc, uint32_t blockSize, q15_t* pResult);
+void arm_cmplx_mult_real_f32(const float32_t* pSrcCmplx, const float32_t* pSrcReal, float32_t* pCmplxDst, uint32_t numSamples);
+void arm_cmplx_mag_q31(const q31_t* pSrc, q31_t* pDst, uint32_t numSamples);
+arm_status arm_sqrt_f32(float32_t in, float32_t* pOut);
+
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32* S, uint8_t numStages, const float32_t* pCoeffs, float32_t* pState);
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32* S, const float32_t* pSrc, float32_t* pDst, uint32_t blockSize);
+
+void ifx_mean_removal_f32(float32_t* data, uint32_t len);
+void ifx_cmplx_mean_removal_f32(cfloat32_t* data, uint32_t len);
+void ifx_window_hann_f32(float32_t* win, uint32_t len);
+void ifx_window_hamming_f32(float32_t* win, uint32_t len);
+void ifx_window_blackmanharris_f32(float32_t* win, uint32_t len);
+void ifx_window_chebyshev_f32(float32_t* win, uint32_t len, float32_t attenuation_db);
+
+#endif /* TEST_HOST_IFX_SENSOR_DSP_H_ */
@@ -0,0 +1,107 @@
+/*
+ * radar_frames.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "radar_frames.h"
+#include "radar_settings.h"
+
+#include <math.h>
+
+#define SPEED_OF_LIGHT		299792458.0
+
+/**
+ * Noise generator (LCG, approximately Gaussian: sum of 4 uniform values)
+ */
+static uint32_t random_state = 1;
+
+static double random_uniform()
+{
+	random_state = random_state * 1664525UL + 1013904223UL;
+	return (double)(random_state >> 8) / (double)(1UL << 24);
+}
+
+static double random_gaussian()
+{
+	double sum = 0;
+	for(uint8_t i = 0; i < 4; ++i)
+	{
+		sum += random_uniform();
+	}
+	// Variance of the sum is 4 / 12
+	return (sum - 2.0) * sqrt(3.0);
+}
+
+uint32_t radar_frames_get_frame_size(const radar_configuration_t* config)
+{
+	return (uint32_t) config->antenna_count * config->chirps_per_frame * config->samples_per_chirp;
+}
+
+void radar_frames_generate(const radar_configuration_t* config, const radar_frames_scene_t* scene, uint16_t* frames, uint32_t frame_count)
+{
+	const double sample_time = 1.0 / (double) config->sampling_rate;
+	const double bandwidth = (double) config->end_freq - (double) config->start_freq;
+	const double slope = bandwidth / ((double) config->samples_per_chirp * sample_time);
+	const double lambda = SPEED_OF_LIGHT / (((double) config->start_freq + (double) config->end_freq) / 2.0);
+	const uint32_t frame_size = radar_frames_get_frame_size(config);
+
+	random_state = scene->seed;
+
+	for(uint32_t frame_idx = 0; frame_idx < frame_count; ++frame_idx)
+	{
+		uint16_t* frame = &frames[frame_idx * frame_size];
+		const double frame_time = (double) frame_idx * config->frame_repetition_time;
+
+		for(uint16_t chirp_idx = 0; chirp_idx < config->chirps_per_frame; ++chirp_idx)
+		{
+			const double time = frame_time + (double) chirp_idx * config->chirp_repetition_time;
+
+			for(uint16_t sample_idx = 0; sample_idx < config->samples_per_chirp; ++sample_idx)
+			{
+				for(uint8_t antenna_idx = 0; antenna_idx < config->antenna_count; ++antenna_idx)
+				{
+					double value = 2048.0 + scene->noise * random_gaussian();
+
+					for(uint8_t target_idx = 0; target_idx < scene->target_count; ++target_idx)
+					{
+						const radar_frames_target_t* target = &scene->targets[target_idx];
+						if ((frame_idx < target->first_frame) || (frame_idx > target->last_frame)) continue;
+
+						const double distance = target->distance + target->velocity * time
+								+ target->breathing_amplitude * sin(2.0 * M_PI * target->breathing_rate * time);
+						const double beat = 2.0 * distance * slope / SPEED_OF_LIGHT;
+						const double phase = 4.0 * M_PI * distance / lambda;
+						value += target->amplitude * cos(2.0 * M_PI * beat * sample_idx * sample_time + phase + antenna_idx);
+					}
+
+					if (value < 0) value = 0;
+					if (value > 4095) value = 4095;
+					frame[((uint32_t) chirp_idx * config->samples_per_chirp + sample_idx) * config->antenna_count + antenna_idx] = (uint16_t) lround(value);
+				}
+			}
+		}
+	}
+}
+
+radar_configuration_t radar_frames_get_default_configuration()
+{
+	radar_configuration_t config;
+	config.antenna_count = XENSIV_BGT60TRXX_CONF_NUM_RX_ANTENNAS;
+	config.chirps_per_frame = XENSIV_BGT60TRXX_CONF_NUM_CHIRPS_PER_FRAME;
+	config.samples_per_chirp = XENSIV_BGT60TRXX_CONF_NUM_SAMPLES_PER_CHIRP;
+	config.sampling_rate = XENSIV_BGT60TRXX_CONF_SAMPLE_RATE;
+	config.start_freq = XENSIV_BGT60TRXX_CONF_START_FREQ_HZ;
+	config.end_freq = XENSIV_BGT60TRXX_CONF_END_FREQ_HZ;
+	config.chirp_repetition_time = XENSIV_BGT60TRXX_CONF_CHIRP_REPETITION_TIME_S;
+	config.frame_repetition_time = XENSIV_BGT60TRXX_CONF_FRAME_REPETITION_TIME_S;
+	return config;
+}
@@ -0,0 +1,63 @@
+/*
+ * radar_frames.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: frames of the BGT60 (interleaved 12-bit samples) synthesized from a scene
+ * Deterministic: the same scene always produces the same frames
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_RADAR_FRAMES_H_
+#define TEST_RADAR_FRAMES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "presence_detection.h"
+
+/**
+ * Point target
+ */
+typedef struct
+{
+	float distance;			/**< Distance at the first frame (m) */
+	float velocity;			/**< Radial velocity (m/s, positive -> moving away) */
+	float amplitude;		/**< Amplitude of the beat signal (ADC counts) */
+	float breathing_amplitude;	/**< Displacement of the chest (m) */
+	float breathing_rate;	/**< Breathing frequency (Hz) */
+	uint32_t first_frame;	/**< Target inside the scene from first_frame to last_frame (included) */
+	uint32_t last_frame;
+} radar_frames_target_t;
+
+typedef struct
+{
+	radar_frames_target_t targets[2];
+	uint8_t target_count;
+	float noise;			/**< Standard deviation of the noise (ADC counts) */
+	uint32_t seed;
+} radar_frames_scene_t;
+
+/**
+ * @brief Samples of one frame
+ */
+uint32_t radar_frames_get_frame_size(const radar_configuration_t* config);
+
+/**
+ * @brief Synthesize frame_count consecutive frames (frames holds frame_count * radar_frames_get_frame_size values)
+ */
+void radar_frames_generate(const radar_configuration_t* config, const radar_frames_scene_t* scene, uint16_t* frames, uint32_t frame_count);
+
+/**
+ * @brief Configuration of radar_settings.h
+ */
+radar_configuration_t radar_frames_get_default_configuration();
+
+#endif /* TEST_RADAR_FRAMES_H_ */
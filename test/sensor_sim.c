@@ -0,0 +1,775 @@
+/*
+ * sensor_sim.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "sensor_sim.h"
+#include "radar_profiles.h"
+
+#include "xensiv_bgt60trxx.h"
+#include "xensiv_bgt60trxx_platform.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * CHIP_ID of a BGT60TR13C (digital ID 3, RF ID 3)
+ */
+#define CHIP_ID_TR13C			0x000303UL
+
+#define BURST_CMD				0xFFU
+#define BURST_HEADER_BYTES		4U
+#define REG_DATA_BYTES			3U
+
+/**
+ * Frame end delay (CCR1): TR_FED * 2^TR_FED_MUL * 8 clock cycles of the 80 MHz sensor clock
+ */
+#define CCR1_TR_FED_POS			11U
+#define CCR1_TR_FED_MSK			0x07f800UL
+#define CCR1_TR_FED_MUL_POS		19U
+#define CCR1_TR_FED_MUL_MSK		0xf80000UL
+#define FRAME_END_DELAY_TICK_NS	100ULL
+
+typedef struct
+{
+	bool active;
+	bool fifo;					/**< FIFO data transfer, else command transfer */
+	uint8_t* tx_data;
+	uint8_t* rx_data;
+	uint32_t len;				/**< Bytes (command) or samples (FIFO) */
+	sensor_sim_fault_t fault;
+	uint64_t end_ns;			/**< End of the transfer (simulated time) */
+	xensiv_bgt60trxx_platform_callback_t callback;
+	void* arg;
+} async_transfer_t;
+
+static uint32_t registers[SENSOR_SIM_NUM_REGS];
+static sensor_sim_stats_t stats;
+static uint32_t spi_frequency = 12500000UL;
+static uint8_t gsr0 = 0;
+
+/**
+ * FIFO (ring buffer of samples)
+ */
+static uint16_t fifo[SENSOR_SIM_FIFO_SAMPLES];
+static uint32_t fifo_head = 0;
+static uint32_t fifo_count = 0;
+
+/**
+ * The platform functions only check that the driver passes this interface
+ */
+static int iface_object;
+
+static volatile bool cs_low = false;
+
+/**
+ * True after a burst read command of the FIFO, until CS is released
+ */
+static bool fifo_burst = false;
+
+static async_transfer_t async_transfer;
+static sensor_sim_fault_t async_fault = SENSOR_SIM_FAULT_NONE;
+static uint32_t async_fault_countdown = 0;
+
+/**
+ * Simulated time and frame generation (frame_profile NULL -> stopped)
+ */
+static uint64_t now_ns = 0;
+static const radar_profile_t* frame_profile = NULL;
+static uint64_t frame_period_ns = 0;
+static uint64_t chirp_ns = 0;
+static uint64_t frame_base_ns = 0;
+static uint16_t frame_chirp = 0;
+static uint16_t test_word = XENSIV_BGT60TRXX_INITIAL_TEST_WORD;
+
+/**
+ * MISO timing limits (0 -> none) and generator of the bit errors
+ */
+static uint32_t miso_max_frequency = 0;
+static uint32_t miso_max_frequency_hs = 0;
+static uint32_t error_seed = 1;
+
+/**
+ * IRQ line (edge -> callback called by sensor_sim_advance)
+ */
+static bool irq_level = false;
+static bool irq_edge = false;
+static sensor_sim_irq_callback_t irq_callback = NULL;
+
+/**
+ * The asynchronous transfers can be completed from another thread
+ */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void reset_registers()
+{
+	memset(registers, 0, sizeof(registers));
+	registers[XENSIV_BGT60TRXX_REG_CHIP_ID] = CHIP_ID_TR13C;
+}
+
+static void reset_fifo()
+{
+	fifo_head = 0;
+	fifo_count = 0;
+	gsr0 &= ~XENSIV_BGT60TRXX_REG_GSR0_FOU_ERR_MSK;
+}
+
+/**
+ * @brief IRQ line after a change of the FIFO level or of the FIFO limit
+ */
+static void update_irq()
+{
+	const uint32_t cref = registers[XENSIV_BGT60TRXX_REG_SFCTL] & XENSIV_BGT60TRXX_REG_SFCTL_FIFO_CREF_MSK;
+	const bool level = (fifo_count / 2U) > cref;
+	if (level && !irq_level)
+	{
+		irq_edge = true;
+		stats.irq_edges++;
+	}
+	irq_level = level;
+}
+
+static bool fifo_add(uint16_t sample)
+{
+	if (fifo_count == SENSOR_SIM_FIFO_SAMPLES)
+	{
+		gsr0 |= XENSIV_BGT60TRXX_REG_GSR0_FOU_ERR_MSK;
+		return false;
+	}
+	fifo[(fifo_head + fifo_count) % SENSOR_SIM_FIFO_SAMPLES] = sample & 0x0FFFU;
+	fifo_count++;
+	return true;
+}
+
+static uint64_t frame_end_delay_ns(uint32_t ccr1)
+{
+	const uint64_t tr = (ccr1 & CCR1_TR_FED_MSK) >> CCR1_TR_FED_POS;
+	const uint64_t mul = (ccr1 & CCR1_TR_FED_MUL_MSK) >> CCR1_TR_FED_MUL_POS;
+	return (tr << mul) * FRAME_END_DELAY_TICK_NS;
+}
+
+/**
+ * @brief Radar profile whose registers are in the register file
+ * (MAIN, SFCTL and CCR1 are changed by the driver at runtime and not compared)
+ */
+static const radar_profile_t* find_profile(uint32_t* profile_ccr1)
+{
+	for (uint8_t id = 0; id < RADAR_PROFILE_COUNT; ++id)
+	{
+		const radar_profile_t* p = &radar_profiles[id];
+		bool match = true;
+		for (uint8_t i = 0; (i < p->register_count) && match; ++i)
+		{
+			const uint32_t address = p->registers[i] >> 25;
+			const uint32_t data = p->registers[i] & 0x00FFFFFFUL;
+			if (address == XENSIV_BGT60TRXX_REG_CCR1)
+			{
+				*profile_ccr1 = data;
+			}
+			else if ((address != XENSIV_BGT60TRXX_REG_MAIN) && (address != XENSIV_BGT60TRXX_REG_SFCTL))
+			{
+				match = (registers[address] == data);
+			}
+		}
+		if (match) return p;
+	}
+	return NULL;
+}
+
+/**
+ * @brief Frame start: the first frame starts now, the frame end delay is the one of the CCR1 register
+ */
+static void start_frames()
+{
+	uint32_t profile_ccr1 = 0;
+	frame_profile = find_profile(&profile_ccr1);
+	if (frame_profile == NULL)
+	{
+		printf("sensor_sim: frame start without the registers of a radar profile\n");
+		return;
+	}
+
+	chirp_ns = (uint64_t)(frame_profile->chirp_repetition_time * 1e9 + 0.5);
+	frame_period_ns = (uint64_t)(frame_profile->frame_repetition_time * 1e9 + 0.5)
+			- frame_end_delay_ns(profile_ccr1) + frame_end_delay_ns(registers[XENSIV_BGT60TRXX_REG_CCR1]);
+	frame_base_ns = now_ns;
+	frame_chirp = 0;
+	stats.frames++;
+}
+
+static void stop_frames()
+{
+	frame_profile = NULL;
+	frame_period_ns = 0;
+}
+
+/**
+ * @brief Pseudo-random generator of the bit errors (xorshift32, reproducible)
+ */
+static uint32_t next_random()
+{
+	error_seed ^= error_seed << 13;
+	error_seed ^= error_seed >> 17;
+	error_seed ^= error_seed << 5;
+	return error_seed;
+}
+
+/**
+ * @brief Bit errors of the data sent on MISO faster than the timing limit of the active SPI speed mode
+ */
+static void apply_miso_errors(uint8_t* data, uint32_t len)
+{
+	const bool high_speed = (registers[XENSIV_BGT60TRXX_REG_SFCTL] & XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK) != 0;
+	const uint32_t limit = high_speed ? miso_max_frequency_hs : miso_max_frequency;
+	if ((limit == 0) || (spi_frequency <= limit)) return;
+
+	for (uint32_t i = 0; i < len * 8U; ++i)
+	{
+		if ((next_random() % SENSOR_SIM_MISO_BIT_ERROR_INTERVAL) == 0)
+		{
+			data[i / 8U] ^= (uint8_t)(1U << (i % 8U));
+			stats.miso_bit_errors++;
+		}
+	}
+}
+
+static uint64_t next_chirp_ns()
+{
+	return frame_base_ns + (uint64_t)(frame_chirp + 1U) * chirp_ns;
+}
+
+/**
+ * @brief End of a chirp: its samples are written into the FIFO (lost if it is full)
+ */
+static void generate_chirp()
+{
+	const uint32_t samples = (uint32_t) frame_profile->rx_antennas * frame_profile->samples_per_chirp;
+	const bool test_mode = (registers[XENSIV_BGT60TRXX_REG_SFCTL] & XENSIV_BGT60TRXX_REG_SFCTL_LFSR_EN_MSK) != 0;
+	if (frame_chirp == 0) test_word = XENSIV_BGT60TRXX_INITIAL_TEST_WORD;
+
+	bool lost = false;
+	for (uint32_t i = 0; i < samples; ++i)
+	{
+		uint16_t sample = SENSOR_SIM_SAMPLE(frame_chirp, i);
+		if (test_mode && ((i % frame_profile->rx_antennas) == 0))
+		{
+			// Test words instead of the samples of the first antenna
+			sample = test_word;
+			test_word = xensiv_bgt60trxx_get_next_test_word(test_word);
+		}
+		if (!fifo_add(sample)) lost = true;
+	}
+	if (lost)
+	{
+		stats.lost_chirps++;
+	}
+	else
+	{
+		stats.chirps++;
+	}
+	update_irq();
+
+	frame_chirp++;
+	if (frame_chirp == frame_profile->chirps_per_frame)
+	{
+		frame_chirp = 0;
+		frame_base_ns += frame_period_ns;
+		stats.frames++;
+	}
+}
+
+/**
+ * @brief Register write decoded from a command (single write or burst)
+ */
+static void write_register(uint32_t address, uint32_t data)
+{
+	if (address >= SENSOR_SIM_NUM_REGS) return;
+
+	switch (address)
+	{
+		case XENSIV_BGT60TRXX_REG_CHIP_ID:
+			// Read only
+			break;
+		case XENSIV_BGT60TRXX_REG_MAIN:
+			if (data & XENSIV_BGT60TRXX_RESET_SW)
+			{
+				reset_registers();
+			}
+			if (data & (XENSIV_BGT60TRXX_RESET_SW | XENSIV_BGT60TRXX_RESET_FSM))
+			{
+				// The FSM reset stops the frame generation and clears the FIFO
+				stop_frames();
+			}
+			if (data & (XENSIV_BGT60TRXX_RESET_SW | XENSIV_BGT60TRXX_RESET_FSM | XENSIV_BGT60TRXX_RESET_FIFO))
+			{
+				reset_fifo();
+			}
+
+			// The reset and frame start bits clear themselves (the reset is done at once)
+			registers[address] = data & ~(XENSIV_BGT60TRXX_REG_MAIN_FRAME_START_MSK | XENSIV_BGT60TRXX_REG_MAIN_RESET_MSK);
+			if (data & XENSIV_BGT60TRXX_REG_MAIN_FRAME_START_MSK)
+			{
+				start_frames();
+			}
+			break;
+		default:
+			registers[address] = data;
+			break;
+	}
+	update_irq();
+}
+
+static uint64_t transfer_time_ns(uint32_t len)
+{
+	return SENSOR_SIM_TRANSFER_OVERHEAD_NS + ((uint64_t) len * 8U * 1000000000ULL) / spi_frequency;
+}
+
+static void account_transfer(uint32_t len)
+{
+	stats.transfers++;
+	stats.bytes += len;
+	stats.bus_time_ns += transfer_time_ns(len);
+}
+
+/**
+ * @brief Command transfer: single register access, burst write or burst read of the FIFO
+ */
+static int32_t execute_command(const uint8_t* tx_data, uint8_t* rx_data, uint32_t len)
+{
+	if (!cs_low || (tx_data == NULL) || (len < BURST_HEADER_BYTES)) return XENSIV_BGT60TRXX_STATUS_COM_ERROR;
+	account_transfer(len);
+
+	if (tx_data[0] == BURST_CMD)
+	{
+		// Header: start address (7 bits), read/write, number of registers (7 bits, 0 -> unlimited read)
+		const uint32_t address = tx_data[1] >> 1;
+		const bool write = (tx_data[1] & 0x01U) != 0;
+		const uint32_t count = tx_data[2] >> 1;
+
+		if (!write)
+		{
+			if ((address != XENSIV_BGT60TRXX_REG_FIFO_TR13C) || (len != BURST_HEADER_BYTES)) return XENSIV_BGT60TRXX_STATUS_COM_ERROR;
+
+			if (rx_data != NULL)
+			{
+				memset(rx_data, 0, BURST_HEADER_BYTES);
+				rx_data[0] = gsr0;
+			}
+			fifo_burst = true;
+			return XENSIV_BGT60TRXX_STATUS_OK;
+		}
+
+		if (len != (BURST_HEADER_BYTES + count * REG_DATA_BYTES)) return XENSIV_BGT60TRXX_STATUS_COM_ERROR;
+
+		const uint8_t* data = &tx_data[BURST_HEADER_BYTES];
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			write_register(address + i, ((uint32_t)data[0] << 16) | ((uint32_t)data[1] << 8) | data[2]);
+			data += REG_DATA_BYTES;
+		}
+		stats.burst_writes++;
+		return XENSIV_BGT60TRXX_STATUS_OK;
+	}
+
+	// Single register: address (7 bits), read/write, 24 bits data
+	const uint32_t address = tx_data[0] >> 1;
+	if ((tx_data[0] & 0x01U) != 0)
+	{
+		write_register(address, ((uint32_t)tx_data[1] << 16) | ((uint32_t)tx_data[2] << 8) | tx_data[3]);
+		stats.register_writes++;
+	}
+	else
+	{
+		const uint32_t value = sensor_sim_get_register(address);
+		if (rx_data != NULL)
+		{
+			// GSR0 then the register content
+			rx_data[0] = gsr0;
+			rx_data[1] = (uint8_t)(value >> 16);
+			rx_data[2] = (uint8_t)(value >> 8);
+			rx_data[3] = (uint8_t) value;
+		}
+		stats.register_reads++;
+	}
+	return XENSIV_BGT60TRXX_STATUS_OK;
+}
+
+/**
+ * @brief FIFO data transfer after the burst read command: 12-bit samples packed MSB first (3 bytes per pair)
+ */
+static int32_t execute_fifo_read(uint8_t* rx_data, uint32_t samples)
+{
+	if (!cs_low || !fifo_burst || (rx_data == NULL) || ((samples % 2U) != 0)) return XENSIV_BGT60TRXX_STATUS_COM_ERROR;
+	account_transfer((samples * 12U) / 8U);
+	stats.fifo_reads++;
+
+	for (uint32_t i = 0; i < samples; i += 2)
+	{
+		uint16_t pair[2] = { 0, 0 };
+		for (uint32_t k = 0; k < 2; ++k)
+		{
+			if (fifo_count == 0)
+			{
+				// Underflow: the burst error is reported with the next command
+				gsr0 |= XENSIV_BGT60TRXX_REG_GSR0_FOU_ERR_MSK;
+				continue;
+			}
+			pair[k] = fifo[fifo_head];
+			fifo_head = (fifo_head + 1U) % SENSOR_SIM_FIFO_SAMPLES;
+			fifo_count--;
+		}
+
+		uint8_t* out = &rx_data[(i / 2U) * 3U];
+		out[0] = (uint8_t)(pair[0] >> 4);
+		out[1] = (uint8_t)(((pair[0] & 0x0FU) << 4) | (pair[1] >> 8));
+		out[2] = (uint8_t) pair[1];
+	}
+	apply_miso_errors(rx_data, (samples * 12U) / 8U);
+	update_irq();
+	return XENSIV_BGT60TRXX_STATUS_OK;
+}
+
+static int32_t start_async(bool fifo_transfer, uint8_t* tx_data, uint8_t* rx_data, uint32_t len,
+		xensiv_bgt60trxx_platform_callback_t callback, void* arg)
+{
+	pthread_mutex_lock(&lock);
+
+	int32_t status = XENSIV_BGT60TRXX_STATUS_OK;
+	if (async_transfer.active || !cs_low)
+	{
+		status = XENSIV_BGT60TRXX_STATUS_COM_ERROR;
+	}
+	else
+	{
+		async_transfer.active = true;
+		async_transfer.fifo = fifo_transfer;
+		async_transfer.tx_data = tx_data;
+		async_transfer.rx_data = rx_data;
+		async_transfer.len = len;
+		async_transfer.callback = callback;
+		async_transfer.arg = arg;
+		async_transfer.end_ns = now_ns + transfer_time_ns(fifo_transfer ? ((len * 12U) / 8U) : len);
+		async_transfer.fault = SENSOR_SIM_FAULT_NONE;
+		if (async_fault != SENSOR_SIM_FAULT_NONE)
+		{
+			if (async_fault_countdown == 0)
+			{
+				async_transfer.fault = async_fault;
+				async_fault = SENSOR_SIM_FAULT_NONE;
+			}
+			else
+			{
+				async_fault_countdown--;
+			}
+		}
+		stats.async_transfers++;
+	}
+
+	pthread_mutex_unlock(&lock);
+	return status;
+}
+
+/**
+ * @brief End of the asynchronous transfer in progress (lock held), the caller calls the callback once unlocked
+ */
+static int32_t finish_async(async_transfer_t* transfer)
+{
+	*transfer = async_transfer;
+	async_transfer.active = false;
+
+	if (transfer->fault != SENSOR_SIM_FAULT_NONE) return XENSIV_BGT60TRXX_STATUS_COM_ERROR;
+	return transfer->fifo ? execute_fifo_read(transfer->rx_data, transfer->len) : execute_command(transfer->tx_data, transfer->rx_data, transfer->len);
+}
+
+void sensor_sim_reset(void)
+{
+	pthread_mutex_lock(&lock);
+	reset_registers();
+	reset_fifo();
+	gsr0 = 0;
+	cs_low = false;
+	fifo_burst = false;
+	memset(&async_transfer, 0, sizeof(async_transfer));
+	async_fault = SENSOR_SIM_FAULT_NONE;
+	memset(&stats, 0, sizeof(stats));
+	now_ns = 0;
+	stop_frames();
+	irq_level = false;
+	irq_edge = false;
+	irq_callback = NULL;
+	miso_max_frequency = 0;
+	miso_max_frequency_hs = 0;
+	error_seed = 1;
+	pthread_mutex_unlock(&lock);
+}
+
+void sensor_sim_set_spi_frequency(uint32_t frequency)
+{
+	spi_frequency = frequency;
+}
+
+void sensor_sim_set_miso_limits(uint32_t max_frequency, uint32_t max_frequency_hs)
+{
+	miso_max_frequency = max_frequency;
+	miso_max_frequency_hs = max_frequency_hs;
+}
+
+void* sensor_sim_get_iface(void)
+{
+	return &iface_object;
+}
+
+uint32_t sensor_sim_get_register(uint32_t address)
+{
+	return (address < SENSOR_SIM_NUM_REGS) ? registers[address] : 0;
+}
+
+uint32_t sensor_sim_push_fifo(const uint16_t* samples, uint32_t count)
+{
+	pthread_mutex_lock(&lock);
+	uint32_t added = 0;
+	while ((added < count) && fifo_add(samples[added]))
+	{
+		added++;
+	}
+	update_irq();
+	pthread_mutex_unlock(&lock);
+	return added;
+}
+
+uint32_t sensor_sim_get_fifo_count(void)
+{
+	return fifo_count;
+}
+
+void sensor_sim_set_gsr0(uint8_t flags)
+{
+	gsr0 = flags;
+}
+
+void sensor_sim_set_async_fault(sensor_sim_fault_t fault, uint32_t transfer)
+{
+	pthread_mutex_lock(&lock);
+	async_fault = fault;
+	async_fault_countdown = transfer;
+	pthread_mutex_unlock(&lock);
+}
+
+bool sensor_sim_complete_async(void)
+{
+	pthread_mutex_lock(&lock);
+	if (!async_transfer.active || (async_transfer.fault == SENSOR_SIM_FAULT_STALL))
+	{
+		pthread_mutex_unlock(&lock);
+		return false;
+	}
+
+	async_transfer_t transfer;
+	const int32_t status = finish_async(&transfer);
+	pthread_mutex_unlock(&lock);
+
+	// The callback can start the next transfer
+	transfer.callback(transfer.arg, status);
+	return true;
+}
+
+bool sensor_sim_is_async_pending(void)
+{
+	return async_transfer.active;
+}
+
+bool sensor_sim_get_cs(void)
+{
+	return !cs_low;
+}
+
+void sensor_sim_advance(uint64_t ns)
+{
+	const uint64_t end_ns = now_ns + ns;
+
+	pthread_mutex_lock(&lock);
+	for (;;)
+	{
+		// Interrupts first, then the next event in time order
+		if (irq_edge)
+		{
+			irq_edge = false;
+			const sensor_sim_irq_callback_t callback = irq_callback;
+			pthread_mutex_unlock(&lock);
+			if (callback != NULL) callback();
+			pthread_mutex_lock(&lock);
+			continue;
+		}
+
+		const bool transfer_pending = async_transfer.active && (async_transfer.fault != SENSOR_SIM_FAULT_STALL);
+		uint64_t next_ns = end_ns;
+		if (transfer_pending && (async_transfer.end_ns < next_ns)) next_ns = async_transfer.end_ns;
+		if ((frame_profile != NULL) && (next_chirp_ns() < next_ns)) next_ns = next_chirp_ns();
+		if (next_ns > now_ns) now_ns = next_ns;
+
+		if (transfer_pending && (async_transfer.end_ns <= now_ns))
+		{
+			async_transfer_t transfer;
+			const int32_t status = finish_async(&transfer);
+			pthread_mutex_unlock(&lock);
+			transfer.callback(transfer.arg, status);
+			pthread_mutex_lock(&lock);
+		}
+		else if ((frame_profile != NULL) && (next_chirp_ns() <= now_ns))
+		{
+			generate_chirp();
+		}
+		else if (now_ns >= end_ns)
+		{
+			break;
+		}
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+uint64_t sensor_sim_get_time_ns(void)
+{
+	return now_ns;
+}
+
+void sensor_sim_set_irq_callback(sensor_sim_irq_callback_t callback)
+{
+	irq_callback = callback;
+}
+
+bool sensor_sim_get_irq(void)
+{
+	return irq_level;
+}
+
+uint64_t sensor_sim_get_frame_period_ns(void)
+{
+	return frame_period_ns;
+}
+
+void sensor_sim_get_stats(sensor_sim_stats_t* result)
+{
+	pthread_mutex_lock(&lock);
+	*result = stats;
+	pthread_mutex_unlock(&lock);
+}
+
+void sensor_sim_clear_stats(void)
+{
+	pthread_mutex_lock(&lock);
+	memset(&stats, 0, sizeof(stats));
+	pthread_mutex_unlock(&lock);
+}
+
+void xensiv_bgt60trxx_platform_rst_set(const void* iface, bool val)
+{
+	xensiv_bgt60trxx_platform_assert(iface == &iface_object);
+
+	if (!val)
+	{
+		pthread_mutex_lock(&lock);
+		reset_registers();
+		reset_fifo();
+		stop_frames();
+		update_irq();
+		pthread_mutex_unlock(&lock);
+	}
+}
+
+void xensiv_bgt60trxx_platform_spi_cs_set(const void* iface, bool val)
+{
+	xensiv_bgt60trxx_platform_assert(iface == &iface_object);
+
+	pthread_mutex_lock(&lock);
+	cs_low = !val;
+	if (val)
+	{
+		fifo_burst = false;
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+int32_t xensiv_bgt60trxx_platform_spi_transfer(void* iface, uint8_t* tx_data, uint8_t* rx_data, uint32_t len)
+{
+	xensiv_bgt60trxx_platform_assert(iface == &iface_object);
+
+	pthread_mutex_lock(&lock);
+	const int32_t status = execute_command(tx_data, rx_data, len);
+	pthread_mutex_unlock(&lock);
+	return status;
+}
+
+int32_t xensiv_bgt60trxx_platform_spi_fifo_read(void* iface, uint16_t* rx_data, uint32_t len)
+{
+	xensiv_bgt60trxx_platform_assert(iface == &iface_object);
+
+	pthread_mutex_lock(&lock);
+	const int32_t status = execute_fifo_read((uint8_t*) rx_data, len);
+	pthread_mutex_unlock(&lock);
+	return status;
+}
+
+int32_t xensiv_bgt60trxx_platform_spi_transfer_async(void* iface, uint8_t* tx_data, uint8_t* rx_data, uint32_t len,
+		xensiv_bgt60trxx_platform_callback_t callback, void* arg)
+{
+	xensiv_bgt60trxx_platform_assert(iface == &iface_object);
+
+	return start_async(false, tx_data, rx_data, len, callback, arg);
+}
+
+int32_t xensiv_bgt60trxx_platform_spi_fifo_read_async(void* iface, uint16_t* rx_data, uint32_t len,
+		xensiv_bgt60trxx_platform_callback_t callback, void* arg)
+{
+	xensiv_bgt60trxx_platform_assert(iface == &iface_object);
+
+	return start_async(true, NULL, (uint8_t*) rx_data, len, callback, arg);
+}
+
+void xensiv_bgt60trxx_platform_spi_abort_async(void* iface)
+{
+	xensiv_bgt60trxx_platform_assert(iface == &iface_object);
+
+	pthread_mutex_lock(&lock);
+	const async_transfer_t transfer = async_transfer;
+	async_transfer.active = false;
+	if (transfer.active)
+	{
+		stats.aborts++;
+	}
+	pthread_mutex_unlock(&lock);
+
+	if (transfer.active)
+	{
+		transfer.callback(transfer.arg, XENSIV_BGT60TRXX_STATUS_COM_ERROR);
+	}
+}
+
+void xensiv_bgt60trxx_platform_delay(uint32_t ms)
+{
+	(void) ms;
+}
+
+uint32_t xensiv_bgt60trxx_platform_word_reverse(uint32_t x)
+{
+	return ((x & 0x000000FFUL) << 24) | ((x & 0x0000FF00UL) << 8) | ((x & 0x00FF0000UL) >> 8) | ((x & 0xFF000000UL) >> 24);
+}
+
+void xensiv_bgt60trxx_platform_assert(bool expr)
+{
+	if (!expr)
+	{
+		printf("xensiv_bgt60trxx_platform_assert failed\n");
+		abort();
+	}
+}
@@ -0,0 +1,181 @@
+/*
+ * sensor_sim.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: simulated BGT60TR13C behind the xensiv_bgt60trxx platform functions
+ * (register file decoded from the SPI commands, burst writes, FIFO, model of the SPI bus time)
+ * The asynchronous transfers are completed by sensor_sim_complete_async, which a test can call from
+ * another thread (SPI interrupt); faults can be injected into them
+ * Simulated time (sensor_sim_advance): once the frame generation is started, the chirps of the radar profile
+ * matching the register file are written into the FIFO, the IRQ line follows the FIFO level and the asynchronous
+ * transfers complete after their bus time
+ * In data test mode (SFCTL LFSR_EN) the first antenna outputs the LFSR test words (restarted with each frame).
+ * Above the MISO timing limit of the sensor, the FIFO data are read with bit errors
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_SENSOR_SIM_H_
+#define TEST_SENSOR_SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @def SENSOR_SIM_TRANSFER_OVERHEAD_NS
+ * @brief Bus time of a transfer besides its clocks: CS edges, start of the SCB transfer, polling of its end
+ */
+#define SENSOR_SIM_TRANSFER_OVERHEAD_NS		2000UL
+
+#define SENSOR_SIM_NUM_REGS					128
+
+/**
+ * FIFO of the BGT60TR13C: 8192 words of two 12-bit samples
+ */
+#define SENSOR_SIM_FIFO_SAMPLES				16384
+
+/**
+ * @def SENSOR_SIM_SAMPLE
+ * @brief Sample generated at an index inside a chirp (antennas interleaved): the chirp index inside the frame
+ * is in the upper 6 bits, so the consumer can check the chirp order
+ */
+#define SENSOR_SIM_SAMPLE(chirp, index)		((uint16_t)((((chirp) & 0x3FU) << 6) | ((index) & 0x3FU)))
+
+/**
+ * @def SENSOR_SIM_MISO_BIT_ERROR_INTERVAL
+ * @brief Above the MISO timing limit, one bit out of SENSOR_SIM_MISO_BIT_ERROR_INTERVAL (on average) is wrong
+ */
+#define SENSOR_SIM_MISO_BIT_ERROR_INTERVAL	1000U
+
+/**
+ * Fault injected into an asynchronous transfer
+ */
+typedef enum
+{
+	SENSOR_SIM_FAULT_NONE = 0,
+	SENSOR_SIM_FAULT_ERROR,			/**< Completed with XENSIV_BGT60TRXX_STATUS_COM_ERROR (SPI error event) */
+	SENSOR_SIM_FAULT_STALL,			/**< Never completed (lost event): only an abort ends it */
+} sensor_sim_fault_t;
+
+typedef struct
+{
+	uint32_t transfers;			/**< SPI transfers (a FIFO read is a command transfer plus a data transfer) */
+	uint32_t bytes;
+	uint32_t register_reads;	/**< Single register commands */
+	uint32_t register_writes;
+	uint32_t burst_writes;
+	uint32_t fifo_reads;		/**< FIFO data transfers */
+	uint32_t async_transfers;	/**< Started asynchronous transfers */
+	uint32_t aborts;			/**< Aborted asynchronous transfers */
+	uint64_t bus_time_ns;		/**< Modeled bus time: per transfer overhead plus 8 clocks per byte */
+	uint32_t frames;			/**< Frames started by the frame generation */
+	uint32_t chirps;			/**< Chirps written into the FIFO */
+	uint32_t lost_chirps;		/**< Chirps lost because the FIFO was full (overflow) */
+	uint32_t irq_edges;			/**< Rising edges of the IRQ line */
+	uint32_t miso_bit_errors;	/**< Bits of the FIFO data inverted (MISO timing limit) */
+} sensor_sim_stats_t;
+
+/**
+ * @brief Rising edge of the IRQ line (GPIO interrupt), called by sensor_sim_advance
+ */
+typedef void (*sensor_sim_irq_callback_t)(void);
+
+/**
+ * @brief Power on: registers at their reset value, statistics cleared, time 0
+ */
+void sensor_sim_reset(void);
+
+/**
+ * @brief SPI clock used by the model of the bus time
+ */
+void sensor_sim_set_spi_frequency(uint32_t frequency);
+
+/**
+ * @brief MISO timing of the sensor: the FIFO data read with a faster SPI clock than max_frequency
+ * (max_frequency_hs in high speed mode, SFCTL MISO_HS_READ) have bit errors. 0 -> no limit (default)
+ */
+void sensor_sim_set_miso_limits(uint32_t max_frequency, uint32_t max_frequency_hs);
+
+/**
+ * @brief Interface given to xensiv_bgt60trxx_init
+ */
+void* sensor_sim_get_iface(void);
+
+/**
+ * @brief Register content seen by the sensor
+ */
+uint32_t sensor_sim_get_register(uint32_t address);
+
+/**
+ * @brief Add samples (12 bits) at the end of the FIFO. Returns the number of samples added (the rest overflows)
+ */
+uint32_t sensor_sim_push_fifo(const uint16_t* samples, uint32_t count);
+
+uint32_t sensor_sim_get_fifo_count(void);
+
+/**
+ * @brief GSR0 flags returned with the next commands (XENSIV_BGT60TRXX_REG_GSR0_*_MSK)
+ */
+void sensor_sim_set_gsr0(uint8_t flags);
+
+/**
+ * @brief Inject a fault into an asynchronous transfer
+ *
+ * @param [in] fault		Fault of the transfer
+ * @param [in] transfer		0 -> next asynchronous transfer, 1 -> the one after... (a FIFO read is the burst command then the data)
+ */
+void sensor_sim_set_async_fault(sensor_sim_fault_t fault, uint32_t transfer);
+
+/**
+ * @brief Complete the asynchronous transfer in progress: data exchanged, callback called (from the calling thread)
+ *
+ * @retval true A transfer was completed (or failed)
+ * @retval false No transfer in progress, or the transfer is stalled
+ */
+bool sensor_sim_complete_async(void);
+
+bool sensor_sim_is_async_pending(void);
+
+/**
+ * @brief Level of the CS line at the last change (true: high, no transfer)
+ */
+bool sensor_sim_get_cs(void);
+
+/**
+ * @brief Let the simulated time pass: chirps of the running frames, end of the asynchronous transfers
+ * (callbacks) and IRQ edges happen in time order, the callbacks are called from the calling thread
+ *
+ * @param [in] ns	Duration in nanoseconds
+ */
+void sensor_sim_advance(uint64_t ns);
+
+/**
+ * @brief Simulated time in nanoseconds since sensor_sim_reset
+ */
+uint64_t sensor_sim_get_time_ns(void);
+
+void sensor_sim_set_irq_callback(sensor_sim_irq_callback_t callback);
+
+/**
+ * @brief Level of the IRQ line: high while the FIFO holds more words than SFCTL FIFO_CREF
+ */
+bool sensor_sim_get_irq(void);
+
+/**
+ * @brief Frame repetition time of the running frame generation in nanoseconds (0 -> stopped)
+ * Frame of the matching radar profile, its frame end delay replaced by the one of the CCR1 register
+ */
+uint64_t sensor_sim_get_frame_period_ns(void);
+
+void sensor_sim_get_stats(sensor_sim_stats_t* stats);
+
+void sensor_sim_clear_stats(void);
+
+#endif /* TEST_SENSOR_SIM_H_ */
@@ -0,0 +1,213 @@
+/*
+ * test_async_fifo.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Asynchronous FIFO read of the sensor driver on the simulated sensor, the transfers being completed
+ * by another thread (SPI interrupt): data, CS and busy flag at the callback, errors of each transfer,
+ * GSR0 error, stalled transfer ended by an abort
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "test_check.h"
+#include "sensor_sim.h"
+
+#include "xensiv_bgt60trxx.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define READ_SAMPLES			1024
+
+/**
+ * Delay of the simulated SPI interrupt after the start of a transfer (us)
+ */
+#define INTERRUPT_DELAY_US		200
+
+/**
+ * Longest wait for a callback (us)
+ */
+#define CALLBACK_TIMEOUT_US		1000000
+
+static xensiv_bgt60trxx_t dev;
+static uint16_t samples[READ_SAMPLES];
+static uint16_t buffer[READ_SAMPLES];
+
+static volatile bool stop = false;
+
+/**
+ * State seen by the callback
+ */
+static volatile uint32_t callback_count = 0;
+static volatile int32_t callback_status = -1;
+static volatile bool callback_cs = false;
+static volatile bool callback_busy = true;
+
+/**
+ * @brief Simulated SPI interrupt: completes the transfers in progress
+ */
+static void* interrupt_thread(void* arg)
+{
+	(void) arg;
+	while (!stop)
+	{
+		usleep(INTERRUPT_DELAY_US);
+		sensor_sim_complete_async();
+	}
+	return NULL;
+}
+
+static void read_done(void* arg, int32_t status)
+{
+	(void) arg;
+	callback_cs = sensor_sim_get_cs();
+	callback_busy = dev.fifo_read_busy;
+	callback_status = status;
+	callback_count++;
+}
+
+/**
+ * @brief Wait for the end of the read (bounded), returns the number of polls done meanwhile
+ */
+static uint32_t wait_read()
+{
+	uint32_t polls = 0;
+	for (uint32_t waited = 0; dev.fifo_read_busy && (waited < CALLBACK_TIMEOUT_US); waited += 10)
+	{
+		usleep(10);
+		polls++;
+	}
+	return polls;
+}
+
+static void start_read(const char* step)
+{
+	callback_count = 0;
+	callback_status = -1;
+	memset(buffer, 0, sizeof(buffer));
+	check(step, xensiv_bgt60trxx_get_fifo_data_async(&dev, buffer, READ_SAMPLES, read_done, NULL) == XENSIV_BGT60TRXX_STATUS_OK);
+}
+
+/**
+ * @brief Check the end of a read: one callback with the expected status, CS released and busy flag cleared before
+ */
+static void check_end(const char* step, int32_t expected_status)
+{
+	if ((callback_count != 1) || (callback_status != expected_status) || !callback_cs || callback_busy || dev.fifo_read_busy)
+	{
+		printf("%s: %u callbacks, status %d (expected %d), CS %s, busy %d\n", step, callback_count, callback_status, expected_status,
+				callback_cs ? "high" : "low", callback_busy);
+		errors++;
+	}
+}
+
+/**
+ * @brief Unpack the 12-bit samples in place (same layout as bgt60trxxx.c)
+ */
+static void unpack(uint16_t* data, uint32_t count)
+{
+	const uint8_t* raw = (const uint8_t*) data;
+	for (uint32_t i = count; i-- > 0;)
+	{
+		const uint32_t byte_index = (i * 3U) / 2U;
+		if (i % 2U == 0)
+		{
+			data[i] = ((uint16_t)raw[byte_index] << 4) | (raw[byte_index + 1] >> 4);
+		}
+		else
+		{
+			data[i] = ((uint16_t)(raw[byte_index] & 0x0FU) << 8) | raw[byte_index + 1];
+		}
+	}
+}
+
+int main()
+{
+	for (uint32_t i = 0; i < READ_SAMPLES; ++i)
+	{
+		samples[i] = (uint16_t)((i * 7U + 3U) & 0x0FFFU);
+	}
+
+	sensor_sim_reset();
+	if (xensiv_bgt60trxx_init(&dev, sensor_sim_get_iface(), false) != XENSIV_BGT60TRXX_STATUS_OK)
+	{
+		printf("xensiv_bgt60trxx_init failed\n");
+		return 1;
+	}
+
+	pthread_t thread;
+	if (pthread_create(&thread, NULL, interrupt_thread, NULL) != 0) return 1;
+
+	// Read completed by the other thread, the calling thread is free meanwhile
+	sensor_sim_push_fifo(samples, READ_SAMPLES);
+	start_read("read");
+	check("read: second request busy", xensiv_bgt60trxx_get_fifo_data_async(&dev, buffer, READ_SAMPLES, read_done, NULL) == XENSIV_BGT60TRXX_STATUS_BUSY);
+	const uint32_t polls = wait_read();
+	check_end("read", XENSIV_BGT60TRXX_STATUS_OK);
+	unpack(buffer, READ_SAMPLES);
+	check("read: data", memcmp(buffer, samples, sizeof(samples)) == 0);
+	check("read: FIFO emptied", sensor_sim_get_fifo_count() == 0);
+	printf("read: %u polls of the calling thread during the read\n", polls);
+
+	// SPI error of the burst command, then of the data transfer
+	sensor_sim_push_fifo(samples, READ_SAMPLES);
+	sensor_sim_set_async_fault(SENSOR_SIM_FAULT_ERROR, 0);
+	start_read("command error");
+	wait_read();
+	check_end("command error", XENSIV_BGT60TRXX_STATUS_COM_ERROR);
+	check("command error: FIFO not read", sensor_sim_get_fifo_count() == READ_SAMPLES);
+
+	sensor_sim_set_async_fault(SENSOR_SIM_FAULT_ERROR, 1);
+	start_read("data error");
+	wait_read();
+	check_end("data error", XENSIV_BGT60TRXX_STATUS_COM_ERROR);
+
+	// GSR0 error reported with the burst command: no data transfer
+	sensor_sim_set_gsr0(XENSIV_BGT60TRXX_REG_GSR0_FOU_ERR_MSK);
+	start_read("GSR0 error");
+	wait_read();
+	check_end("GSR0 error", XENSIV_BGT60TRXX_STATUS_GSR0_ERROR);
+	check("GSR0 error: flags", xensiv_bgt60trxx_get_fifo_read_gsr0(&dev) == XENSIV_BGT60TRXX_REG_GSR0_FOU_ERR_MSK);
+	sensor_sim_set_gsr0(0);
+
+	// Lost completion: the read stays busy until it is aborted
+	sensor_sim_set_async_fault(SENSOR_SIM_FAULT_STALL, 1);
+	start_read("stall");
+	usleep(20 * INTERRUPT_DELAY_US);
+	check("stall: still busy", dev.fifo_read_busy && (callback_count == 0));
+	xensiv_bgt60trxx_abort_fifo_data_async(&dev);
+	check_end("stall: abort", XENSIV_BGT60TRXX_STATUS_COM_ERROR);
+	sensor_sim_stats_t stats;
+	sensor_sim_get_stats(&stats);
+	check("stall: transfer aborted", stats.aborts == 1);
+
+	// Abort without read in progress: nothing happens
+	callback_count = 0;
+	xensiv_bgt60trxx_abort_fifo_data_async(&dev);
+	check("abort without read", callback_count == 0);
+
+	// The next read works
+	sensor_sim_reset();
+	sensor_sim_push_fifo(samples, READ_SAMPLES);
+	start_read("read after abort");
+	wait_read();
+	check_end("read after abort", XENSIV_BGT60TRXX_STATUS_OK);
+	unpack(buffer, READ_SAMPLES);
+	check("read after abort: data", memcmp(buffer, samples, sizeof(samples)) == 0);
+
+	stop = true;
+	pthread_join(thread, NULL);
+
+	return check_result();
+}
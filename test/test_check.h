@@ -0,0 +1,56 @@
+/*
+ * test_check.h
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Host build of the tests: error counter of a test executable (one per executable, included by the test source only),
+ * failed checks printed with their step, result printed at the end and returned by main
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#ifndef TEST_TEST_CHECK_H_
+#define TEST_TEST_CHECK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+/**
+ * Errors found by the test (checks can also count their own errors here)
+ */
+static uint32_t errors = 0;
+
+/**
+ * @brief Count an error (and print the step) if condition is false
+ */
+static inline void check(const char* step, bool condition)
+{
+	if (!condition)
+	{
+		printf("%s: failed\n", step);
+		errors++;
+	}
+}
+
+/**
+ * @brief Print the result of the test, returns the exit code of main (0 -> passed)
+ */
+static inline int check_result(void)
+{
+	if (errors != 0)
+	{
+		printf("FAILED: %u errors\n", errors);
+		return 1;
+	}
+	printf("PASSED\n");
+	return 0;
+}
+
+#endif /* TEST_TEST_CHECK_H_ */
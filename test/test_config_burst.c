@@ -0,0 +1,165 @@
+/*
+ * test_config_burst.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Register configuration of each radar profile written to the simulated sensor in three ways:
+ * one write per register (reference), xensiv_bgt60trxx_config (bursts) and xensiv_bgt60trxx_config_encoded
+ * (pre-encoded bursts). The register files must be identical, the bursts need less transfers and less bus time
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "sensor_sim.h"
+#include "radar_profiles.h"
+
+#include "xensiv_bgt60trxx.h"
+
+#include <stdio.h>
+#include <string.h>
+
+typedef enum
+{
+	WRITE_PER_REGISTER = 0,
+	WRITE_BURSTS,
+	WRITE_ENCODED,
+	WRITE_METHOD_COUNT,
+} write_method_t;
+
+static const char* method_names[WRITE_METHOD_COUNT] = { "per register", "bursts", "encoded bursts" };
+
+/**
+ * SPI clocks of the calibration (bgt60trxxx.c)
+ */
+static const uint32_t frequencies[] = { 12500000UL, 25000000UL, 50000000UL };
+
+static xensiv_bgt60trxx_t dev;
+
+static uint8_t encoded[XENSIV_BGT60TRXX_CONFIG_ENCODED_SIZE(RADAR_PROFILE_MAX_REGS)];
+
+/**
+ * @brief Reference: soft reset then one CS-framed write per register
+ * (the FIFO limit and the MISO high-speed bit are not taken from the list, as in xensiv_bgt60trxx_config)
+ */
+static int32_t write_per_register(const radar_profile_t* profile)
+{
+	int32_t status = xensiv_bgt60trxx_soft_reset(&dev, XENSIV_BGT60TRXX_RESET_SW);
+	for (uint8_t i = 0; (i < profile->register_count) && (status == XENSIV_BGT60TRXX_STATUS_OK); ++i)
+	{
+		const uint32_t address = profile->registers[i] >> 25;
+		uint32_t data = profile->registers[i] & 0x00FFFFFFUL;
+		if (address == XENSIV_BGT60TRXX_REG_SFCTL)
+		{
+			data &= ~(XENSIV_BGT60TRXX_REG_SFCTL_FIFO_CREF_MSK | XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK);
+		}
+		status = xensiv_bgt60trxx_set_reg(&dev, address, data);
+	}
+	return status;
+}
+
+static int32_t write_configuration(const radar_profile_t* profile, write_method_t method)
+{
+	switch (method)
+	{
+		case WRITE_PER_REGISTER:
+			return write_per_register(profile);
+		case WRITE_BURSTS:
+			return xensiv_bgt60trxx_config(&dev, profile->registers, profile->register_count);
+		default:
+		{
+			const uint32_t size = xensiv_bgt60trxx_config_encode(&dev, profile->registers, profile->register_count, encoded);
+			return xensiv_bgt60trxx_config_encoded(&dev, encoded, size);
+		}
+	}
+}
+
+int main()
+{
+	uint32_t errors = 0;
+
+	for (uint8_t profile_idx = 0; profile_idx < RADAR_PROFILE_COUNT; ++profile_idx)
+	{
+		const radar_profile_t* profile = &radar_profiles[profile_idx];
+		printf("Profile %s: %u registers\n", profile->name, profile->register_count);
+
+		uint32_t reference[SENSOR_SIM_NUM_REGS];
+		sensor_sim_stats_t stats[WRITE_METHOD_COUNT][sizeof(frequencies) / sizeof(frequencies[0])];
+
+		for (uint8_t method = 0; method < WRITE_METHOD_COUNT; ++method)
+		{
+			for (uint8_t freq_idx = 0; freq_idx < sizeof(frequencies) / sizeof(frequencies[0]); ++freq_idx)
+			{
+				sensor_sim_reset();
+				sensor_sim_set_spi_frequency(frequencies[freq_idx]);
+				if (xensiv_bgt60trxx_init(&dev, sensor_sim_get_iface(), false) != XENSIV_BGT60TRXX_STATUS_OK)
+				{
+					printf("xensiv_bgt60trxx_init failed\n");
+					return 1;
+				}
+
+				sensor_sim_clear_stats();
+				if (write_configuration(profile, (write_method_t) method) != XENSIV_BGT60TRXX_STATUS_OK)
+				{
+					printf("  %s: configuration failed\n", method_names[method]);
+					errors++;
+				}
+				sensor_sim_get_stats(&stats[method][freq_idx]);
+
+				// Same register file whatever the method
+				for (uint32_t address = 0; address < SENSOR_SIM_NUM_REGS; ++address)
+				{
+					const uint32_t value = sensor_sim_get_register(address);
+					if ((method == WRITE_PER_REGISTER) && (freq_idx == 0))
+					{
+						reference[address] = value;
+					}
+					else if (value != reference[address])
+					{
+						printf("  %s: register 0x%02X is 0x%06X instead of 0x%06X\n", method_names[method], address, value, reference[address]);
+						errors++;
+					}
+				}
+			}
+
+			const sensor_sim_stats_t* s = &stats[method][0];
+			printf("  %-15s %3u transfers (%u register reads, %u register writes, %u bursts), %4u bytes, bus time",
+					method_names[method], s->transfers, s->register_reads, s->register_writes, s->burst_writes, s->bytes);
+			for (uint8_t freq_idx = 0; freq_idx < sizeof(frequencies) / sizeof(frequencies[0]); ++freq_idx)
+			{
+				printf(" %6.1f us @ %.1f MHz", stats[method][freq_idx].bus_time_ns / 1000.0, frequencies[freq_idx] / 1e6);
+			}
+			printf("\n");
+		}
+
+		for (uint8_t method = WRITE_BURSTS; method < WRITE_METHOD_COUNT; ++method)
+		{
+			if (stats[method][0].transfers >= stats[WRITE_PER_REGISTER][0].transfers)
+			{
+				printf("  %s: no less transfers than the reference\n", method_names[method]);
+				errors++;
+			}
+			for (uint8_t freq_idx = 0; freq_idx < sizeof(frequencies) / sizeof(frequencies[0]); ++freq_idx)
+			{
+				if (stats[method][freq_idx].bus_time_ns >= stats[WRITE_PER_REGISTER][freq_idx].bus_time_ns)
+				{
+					printf("  %s: no shorter than the reference at %u Hz\n", method_names[method], frequencies[freq_idx]);
+					errors++;
+				}
+			}
+		}
+	}
+
+	if (errors != 0)
+	{
+		printf("FAILED: %u errors\n", errors);
+		return 1;
+	}
+	printf("PASSED\n");
+	return 0;
+}
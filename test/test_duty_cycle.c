@@ -0,0 +1,208 @@
+/*
+ * test_duty_cycle.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Duty cycling of the frame rate (duty_cycle.c) driving bgt60trxxx_set_frame_repetition_time on the simulated
+ * sensor, with the same hook as main.c (the presence detection is told the new frame time). Scripted scene:
+ * empty, presence, empty again. Checks the frame period measured at each frame time, the wake latency, the
+ * time accounting, a failed switch (frame still owned) retried with the next frame, the frames read after
+ * each switch, and the vital signs suspended at the idle frame time only
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "test_check.h"
+#include "sensor_sim.h"
+#include "bgt60trxxx.h"
+#include "duty_cycle.h"
+#include "hal_timer.h"
+#include "presence_detection.h"
+
+#include "cyhal_system.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define IDLE_FRAME_TIME_S		1.f
+#define IDLE_FRAMES				10U
+
+/**
+ * Scene: presence from PRESENCE_FIRST to PRESENCE_LAST (frames), the frame ending the presence switch fails once
+ */
+#define PRESENCE_FIRST			25U
+#define PRESENCE_LAST			39U
+#define FAILED_SWITCH_FRAME		(PRESENCE_LAST + IDLE_FRAMES)
+#define FRAME_COUNT				60U
+
+/**
+ * Tolerance on the measured frame periods (FIFO read and polling)
+ */
+#define PERIOD_TOLERANCE_S		0.002f
+
+#define POLL_US					100
+
+/**
+ * @brief Same hook as main.c
+ */
+static int set_frame_time(void* context, float frame_time)
+{
+	(void) context;
+
+	int retval = bgt60trxxx_set_frame_repetition_time(frame_time);
+	if (retval != 0) return retval;
+
+	return presence_detection_set_frame_repetition_time(frame_time);
+}
+
+static const duty_cycle_iface_t iface =
+{
+	.set_frame_time = set_frame_time,
+	.get_time = hal_timer_get_uticks,
+	.context = NULL,
+};
+
+static bool check_frame(const uint16_t* frame)
+{
+	const uint32_t chirp_samples = (uint32_t) bgt60trxxx_get_antenna_count() * bgt60trxxx_get_samples_per_chirp();
+	for (uint16_t chirp = 0; chirp < bgt60trxxx_get_chirps_per_frame(); ++chirp)
+	{
+		if (frame[chirp * chirp_samples] != SENSOR_SIM_SAMPLE(chirp, 0)) return false;
+	}
+	return true;
+}
+
+static uint16_t* wait_frame()
+{
+	for (uint32_t waited = 0; waited < 3000000U; waited += POLL_US)
+	{
+		uint16_t* frame;
+		const int retval = bgt60trxxx_acquire_frame(&frame);
+		if (retval == 0) return frame;
+		if (retval < 0) return NULL;
+		CyDelayUs(POLL_US);
+	}
+	return NULL;
+}
+
+static int init_presence_detection()
+{
+	radar_configuration_t config;
+	config.antenna_count = bgt60trxxx_get_antenna_count();
+	config.chirps_per_frame = bgt60trxxx_get_chirps_per_frame();
+	config.samples_per_chirp = bgt60trxxx_get_samples_per_chirp();
+	config.start_freq = bgt60trxxx_get_start_freq();
+	config.end_freq = bgt60trxxx_get_end_freq();
+	config.sampling_rate = bgt60trxxx_get_sampling_rate();
+	config.chirp_repetition_time = bgt60trxxx_get_chirp_repetition_time();
+	config.frame_repetition_time = bgt60trxxx_get_frame_repetition_time();
+
+	presence_detection_param_t params = { 0 };
+	params.threshold = 0.56f;
+	params.threshold_exit = 0.42f;
+	params.confirm_frames = 3;
+	params.hold_frames = 50;
+	params.slow_time_history = 1;
+	params.vital_signs = true;
+	params.arithmetic = PRESENCE_DETECTION_ARITHMETIC_FLOAT;
+	params.range_cube_format = RANGE_CUBE_FORMAT_FLOAT32;
+	params.range_window = WINDOW_BLACKMAN_HARRIS;
+	params.doppler_window = WINDOW_NONE;
+
+	presence_detection_set_malloc_free(malloc, free);
+	return presence_detection_init(config, params);
+}
+
+int main()
+{
+	sensor_sim_reset();
+	if (bgt60trxxx_init() != 0)
+	{
+		printf("bgt60trxxx_init failed\n");
+		return 1;
+	}
+	if (init_presence_detection() != 0)
+	{
+		printf("presence_detection_init failed\n");
+		return 1;
+	}
+
+	duty_cycle_param_t params;
+	params.active_frame_time = bgt60trxxx_get_frame_repetition_time();
+	params.idle_frame_time = IDLE_FRAME_TIME_S;
+	params.idle_frames = IDLE_FRAMES;
+	check("duty_cycle_init", duty_cycle_init(&iface, &params) == 0);
+	const uint32_t start_us = hal_timer_get_uticks();
+	uint32_t last_update_us = start_us;
+
+	uint32_t data_errors = 0;
+	uint32_t period_errors = 0;
+	uint32_t vital_signs_errors = 0;
+	uint64_t last_frame_ns = 0;
+	bool switched = true;
+	for (uint32_t k = 0; k < FRAME_COUNT; ++k)
+	{
+		uint16_t* frame = wait_frame();
+		if (frame == NULL)
+		{
+			printf("frame %u: no frame\n", k);
+			errors++;
+			break;
+		}
+		const uint64_t now_ns = sensor_sim_get_time_ns();
+		if (!check_frame(frame)) data_errors++;
+
+		// Period of the current frame time (the frame following a switch comes earlier: restart)
+		const duty_cycle_mode_t mode = duty_cycle_get_mode();
+		const float frame_time = (mode == DUTY_CYCLE_ACTIVE) ? params.active_frame_time : params.idle_frame_time;
+		const float period = (float)(now_ns - last_frame_ns) * 1e-9f;
+		if (!switched && (fabsf(period - frame_time) > PERIOD_TOLERANCE_S))
+		{
+			printf("frame %u: period %.4f s, expected %.4f s\n", k, period, frame_time);
+			period_errors++;
+		}
+		last_frame_ns = now_ns;
+
+		// Failed switch: the frame is still owned by the consumer
+		if (k != FAILED_SWITCH_FRAME) bgt60trxxx_release_frame(frame);
+		const bool presence = (k >= PRESENCE_FIRST) && (k <= PRESENCE_LAST);
+		const int retval = duty_cycle_update(presence);
+		last_update_us = hal_timer_get_uticks();
+		if (k == FAILED_SWITCH_FRAME) bgt60trxxx_release_frame(frame);
+		switched = (retval == 1);
+
+		if (retval != 0)
+		{
+			printf("frame %u: %d -> %s, %.3f s per frame (measured %.3f s)\n", k, retval,
+					(duty_cycle_get_mode() == DUTY_CYCLE_ACTIVE) ? "active" : "idle", bgt60trxxx_get_frame_repetition_time(),
+					sensor_sim_get_frame_period_ns() * 1e-9);
+		}
+
+		// Vital signs only at the active frame time
+		if ((presence_detection_get_vital_signs() != NULL) != (duty_cycle_get_mode() == DUTY_CYCLE_ACTIVE)) vital_signs_errors++;
+	}
+
+	duty_cycle_stats_t stats;
+	duty_cycle_get_stats(&stats);
+	printf("%u wakeups, %u sleeps, %u errors, wake latency %u us, active %.1f s (%u frames), idle %.1f s (%u frames)\n",
+			stats.wakeups, stats.sleeps, stats.errors, stats.max_wake_latency, stats.active_time * 1e-6, stats.active_frames,
+			stats.idle_time * 1e-6, stats.idle_frames);
+
+	check("frame data", data_errors == 0);
+	check("frame periods", period_errors == 0);
+	check("vital signs suspended at the idle frame time", vital_signs_errors == 0);
+	check("switches", (stats.wakeups == 1) && (stats.sleeps == 2) && (stats.errors == 1));
+	check("idle at the end", duty_cycle_get_mode() == DUTY_CYCLE_IDLE);
+	check("wake latency below an active frame", stats.max_wake_latency < (uint32_t)(params.active_frame_time * 1e6f));
+	check("frames accounted", stats.active_frames + stats.idle_frames == FRAME_COUNT);
+	check("time accounted", stats.active_time + stats.idle_time == (uint32_t)(last_update_us - start_us));
+
+	return check_result();
+}
@@ -0,0 +1,210 @@
+/*
+ * test_fifo_streaming.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Streaming acquisition of bgt60trxxx.c (one chirp per FIFO read, BGT60TRXXX_CHIRPS_PER_READ=1) on the
+ * simulated sensor: a read lasts longer than a chirp, so the FIFO level is reached again during the reads and
+ * the IRQ line stays high (no rising edge). Every chirp must still be delivered once, in order, without FIFO
+ * error, with a fast consumer and with a consumer keeping all the buffers of the pool. After a FIFO error no data
+ * is available until the end of the recovery backoff, whose delay is given to the main loop (no busy wait)
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "test_check.h"
+#include "sensor_sim.h"
+#include "bgt60trxxx.h"
+
+#include "xensiv_bgt60trxx.h"
+#include "cyhal_system.h"
+
+#include <stdio.h>
+
+/**
+ * Frame repetition time of the test (more frames per simulated second than the profile)
+ */
+#define FRAME_REPETITION_TIME_S		0.01f
+
+#define RUN_TIME_NS					500000000ULL
+
+/**
+ * Polling period of the consumer while no chirps are available
+ */
+#define POLL_US						10
+
+typedef struct
+{
+	uint32_t chirps;			/**< Chirps delivered */
+	uint32_t fifo_errors;
+	uint32_t order_errors;
+	uint32_t data_errors;
+	int32_t next_chirp;			/**< Expected first chirp of the next read (-1 -> any) */
+} consumer_t;
+
+/**
+ * @brief Chirps of a FIFO read: first sample of each antenna and chirp, order of the reads
+ */
+static void check_chirps(consumer_t* consumer, const uint16_t* samples, uint16_t first_chirp)
+{
+	const uint16_t chirps = bgt60trxxx_get_chirps_per_read();
+	const uint32_t chirp_samples = (uint32_t) bgt60trxxx_get_antenna_count() * bgt60trxxx_get_samples_per_chirp();
+
+	if ((consumer->next_chirp >= 0) && (first_chirp != consumer->next_chirp)) consumer->order_errors++;
+	consumer->next_chirp = (first_chirp + chirps) % bgt60trxxx_get_chirps_per_frame();
+
+	for (uint16_t k = 0; k < chirps; ++k)
+	{
+		const uint16_t chirp = first_chirp + k;
+		const uint16_t* chirp_data = &samples[k * chirp_samples];
+		if ((chirp_data[0] != SENSOR_SIM_SAMPLE(chirp, 0)) || (chirp_data[chirp_samples - 1U] != SENSOR_SIM_SAMPLE(chirp, chirp_samples - 1U)))
+		{
+			consumer->data_errors++;
+		}
+	}
+	consumer->chirps += chirps;
+}
+
+/**
+ * @brief Main loop of the consumer: processing_us per read, hold buffers acquired before releasing the oldest
+ */
+static void run(consumer_t* consumer, uint64_t duration_ns, uint16_t processing_us, uint8_t hold)
+{
+	uint16_t* held[4];
+	uint8_t held_count = 0;
+
+	const uint64_t end_ns = sensor_sim_get_time_ns() + duration_ns;
+	while (sensor_sim_get_time_ns() < end_ns)
+	{
+		uint16_t* samples;
+		uint16_t first_chirp;
+		const int retval = bgt60trxxx_acquire_chirps(&samples, &first_chirp);
+		if (retval == 0)
+		{
+			check_chirps(consumer, samples, first_chirp);
+			CyDelayUs(processing_us);
+
+			held[held_count++] = samples;
+			if (held_count > hold)
+			{
+				bgt60trxxx_release_frame(held[0]);
+				for (uint8_t i = 1; i < held_count; ++i) held[i - 1] = held[i];
+				held_count--;
+			}
+		}
+		else if (retval < 0)
+		{
+			consumer->fifo_errors++;
+			consumer->next_chirp = -1;
+		}
+		else
+		{
+			CyDelayUs(POLL_US);
+		}
+	}
+
+	for (uint8_t i = 0; i < held_count; ++i)
+	{
+		bgt60trxxx_release_frame(held[i]);
+	}
+}
+
+static void run_scenario(const char* name, uint16_t processing_us, uint8_t hold)
+{
+	consumer_t consumer = { .next_chirp = -1 };
+
+	check(name, bgt60trxxx_set_frame_repetition_time(FRAME_REPETITION_TIME_S) == 0);
+	sensor_sim_clear_stats();
+	run(&consumer, RUN_TIME_NS, processing_us, hold);
+
+	sensor_sim_stats_t stats;
+	sensor_sim_get_stats(&stats);
+	bgt60trxxx_fifo_stats_t fifo_stats;
+	bgt60trxxx_get_fifo_stats(&fifo_stats);
+
+	// The chirps still inside the FIFO or inside the pool at the end are not delivered yet
+	const uint32_t chirp_samples = (uint32_t) bgt60trxxx_get_antenna_count() * bgt60trxxx_get_samples_per_chirp();
+	const uint32_t in_flight = sensor_sim_get_fifo_count() / chirp_samples + 2U * bgt60trxxx_get_chirps_per_read() + 1U;
+
+	printf("%s: %u chirps measured, %u delivered, %u FIFO reads, %u IRQ edges, %u lost, %u FIFO errors\n",
+			name, stats.chirps, consumer.chirps, stats.fifo_reads, stats.irq_edges, stats.lost_chirps, consumer.fifo_errors);
+
+	if ((consumer.chirps + in_flight < stats.chirps) || (consumer.chirps > stats.chirps))
+	{
+		printf("%s: %u chirps delivered of %u\n", name, consumer.chirps, stats.chirps);
+		errors++;
+	}
+	check("no chirp lost", stats.lost_chirps == 0);
+	check("no FIFO error", (consumer.fifo_errors == 0) && (fifo_stats.fifo_overflow == 0) && (fifo_stats.communication == 0));
+	check("chirp order", consumer.order_errors == 0);
+	check("chirp data", consumer.data_errors == 0);
+}
+
+/**
+ * @brief FIFO error (SPI burst error reported by GSR0): recovery after the backoff
+ */
+static void run_recovery()
+{
+	check("recovery", bgt60trxxx_set_frame_repetition_time(FRAME_REPETITION_TIME_S) == 0);
+	check("no recovery pending", bgt60trxxx_get_recovery_delay() == 0);
+
+	sensor_sim_set_gsr0(XENSIV_BGT60TRXX_REG_GSR0_SPI_BURST_ERR_MSK);
+	int retval = 1;
+	uint16_t* samples;
+	for (uint32_t waited = 0; (retval == 1) && (waited < 100000U); waited += POLL_US)
+	{
+		CyDelayUs(POLL_US);
+		retval = bgt60trxxx_acquire_chirps(&samples, NULL);
+		if (retval == 0) bgt60trxxx_release_frame(samples);
+	}
+	sensor_sim_set_gsr0(0);
+	check("FIFO error", retval == -1);
+
+	// Backoff: nothing to do until the deadline
+	const uint32_t delay = bgt60trxxx_get_recovery_delay();
+	printf("recovery: backoff of %u us\n", delay);
+	check("recovery delay", delay > 0);
+	check("no data during the backoff", bgt60trxxx_is_data_available() == 0);
+	check("no recovery during the backoff", bgt60trxxx_acquire_chirps(&samples, NULL) == 1);
+
+	// Deadline: the recovery is due then done, the chirps come again
+	CyDelayUs((uint16_t) delay);
+	check("recovery due", (bgt60trxxx_get_recovery_delay() == 0) && (bgt60trxxx_is_data_available() != 0));
+	check("recovery done", bgt60trxxx_acquire_chirps(&samples, NULL) == 1);
+
+	retval = 1;
+	for (uint32_t waited = 0; (retval == 1) && (waited < 100000U); waited += POLL_US)
+	{
+		CyDelayUs(POLL_US);
+		retval = bgt60trxxx_acquire_chirps(&samples, NULL);
+	}
+	check("chirps after the recovery", retval == 0);
+	if (retval == 0) bgt60trxxx_release_frame(samples);
+}
+
+int main()
+{
+	sensor_sim_reset();
+	if (bgt60trxxx_init() != 0)
+	{
+		printf("bgt60trxxx_init failed\n");
+		return 1;
+	}
+	check("one chirp per read", bgt60trxxx_get_chirps_per_read() == 1);
+
+	// Fast consumer: the reads follow each other while the IRQ line stays high
+	run_scenario("fast consumer", 20, 0);
+
+	// The consumer keeps a buffer while processing the next one: the reads wait for a free buffer
+	run_scenario("slow consumer", 200, 1);
+
+	run_recovery();
+
+	return check_result();
+}
@@ -0,0 +1,231 @@
+/*
+ * test_fixed_point.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Fixed-point pipeline (Q15 range FFT, Q31 Doppler FFT) against the float pipeline on the same frames:
+ * same detections (same state changes of each zone, at most one frame apart when a magnitude is close to a threshold),
+ * magnitudes within the tolerance and same peaks
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "presence_detection.h"
+#include "radar_frames.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define FRAME_COUNT			200
+
+/**
+ * Tolerance of the fixed-point magnitudes: relative to the float magnitude, plus an absolute part for the noise floor
+ */
+#define MAGNITUDE_TOLERANCE_REL		0.03f
+#define MAGNITUDE_TOLERANCE_ABS		0.02f
+
+/**
+ * Tolerance of the interpolated peak of a zone above the enter threshold (m)
+ */
+#define DISTANCE_TOLERANCE			0.02f
+
+/**
+ * Tolerance of the frame of a state change
+ */
+#define TRANSITION_TOLERANCE		1
+
+#define MAX_TRANSITIONS				32
+
+typedef struct
+{
+	uint32_t frame;
+	presence_state_t state;
+} transition_t;
+
+static const presence_detection_zone_t zones[] =
+{
+	{ .start = 0.3f, .end = 2.f, .threshold = 0.56f, .threshold_exit = 0.42f },
+	{ .start = 2.f, .end = 5.f, .threshold = 0.56f, .threshold_exit = 0.42f },
+};
+
+/**
+ * Empty room, a person walking away through both zones, then a second person walking back inside the far zone
+ */
+static const radar_frames_scene_t scene =
+{
+	.targets =
+	{
+		{ .distance = 0.8f, .velocity = 0.25f, .amplitude = 30.f, .breathing_amplitude = 0.004f, .breathing_rate = 0.3f, .first_frame = 40, .last_frame = 119 },
+		{ .distance = 4.5f, .velocity = -0.4f, .amplitude = 20.f, .breathing_amplitude = 0, .breathing_rate = 0, .first_frame = 140, .last_frame = 179 },
+	},
+	.target_count = 2,
+	.noise = 2.f,
+	.seed = 12345,
+};
+
+static presence_detection_param_t get_params(presence_detection_arithmetic_t arithmetic)
+{
+	presence_detection_param_t params = { 0 };
+	params.threshold = 0.56f;
+	params.threshold_exit = 0.42f;
+	params.confirm_frames = 3;
+	params.hold_frames = 10;
+	params.zones = zones;
+	params.zone_count = sizeof(zones) / sizeof(zones[0]);
+	params.slow_time_history = 1;
+	params.vital_signs = true;
+	params.arithmetic = arithmetic;
+	params.range_cube_format = RANGE_CUBE_FORMAT_FLOAT32;
+	params.range_zoom = 1;
+	params.range_fft_padding = 1;
+	params.range_window = WINDOW_BLACKMAN_HARRIS;
+	params.doppler_window = WINDOW_NONE;
+	return params;
+}
+
+/**
+ * @brief State changes of a zone
+ */
+static uint32_t get_transitions(const presence_detection_frame_result_t* results, uint8_t zone_idx, transition_t* transitions)
+{
+	uint32_t count = 0;
+	for(uint32_t frame_idx = 0; (frame_idx < FRAME_COUNT) && (count < MAX_TRANSITIONS); ++frame_idx)
+	{
+		const presence_detection_zone_frame_result_t* zone = &results[frame_idx].zones[zone_idx];
+		if (!zone->changed) continue;
+
+		transitions[count].frame = frame_idx;
+		transitions[count].state = zone->state;
+		count++;
+	}
+	return count;
+}
+
+static int run(const radar_configuration_t* config, presence_detection_arithmetic_t arithmetic, uint16_t* frames, presence_detection_frame_result_t* results)
+{
+	int retval = presence_detection_init(*config, get_params(arithmetic));
+	if (retval != 0)
+	{
+		printf("presence_detection_init (arithmetic %d) error: %d\n", arithmetic, retval);
+		return -1;
+	}
+
+	return presence_detection_feed_batch(frames, FRAME_COUNT, results);
+}
+
+int main()
+{
+	const radar_configuration_t config = radar_frames_get_default_configuration();
+	const uint32_t frame_size = radar_frames_get_frame_size(&config);
+
+	uint16_t* frames = malloc(FRAME_COUNT * frame_size * sizeof(uint16_t));
+	presence_detection_frame_result_t* float_results = calloc(FRAME_COUNT, sizeof(presence_detection_frame_result_t));
+	presence_detection_frame_result_t* fixed_results = calloc(FRAME_COUNT, sizeof(presence_detection_frame_result_t));
+	if ((frames == NULL) || (float_results == NULL) || (fixed_results == NULL)) return 1;
+
+	radar_frames_generate(&config, &scene, frames, FRAME_COUNT);
+
+	presence_detection_set_malloc_free(malloc, free);
+	if (run(&config, PRESENCE_DETECTION_ARITHMETIC_FLOAT, frames, float_results) != 0) return 1;
+	if (run(&config, PRESENCE_DETECTION_ARITHMETIC_FIXED_POINT, frames, fixed_results) != 0) return 1;
+
+	const uint8_t zone_count = sizeof(zones) / sizeof(zones[0]);
+	uint32_t errors = 0;
+	uint32_t detections[sizeof(zones) / sizeof(zones[0])] = { 0 };
+	float max_error = 0;
+
+	for(uint32_t frame_idx = 0; frame_idx < FRAME_COUNT; ++frame_idx)
+	{
+		const presence_detection_frame_result_t* fl = &float_results[frame_idx];
+		const presence_detection_frame_result_t* fx = &fixed_results[frame_idx];
+
+		for(uint8_t zone_idx = 0; zone_idx < zone_count; ++zone_idx)
+		{
+			const presence_detection_zone_frame_result_t* zfl = &fl->zones[zone_idx];
+			const presence_detection_zone_frame_result_t* zfx = &fx->zones[zone_idx];
+
+			if (zfl->state == PRESENCE_STATE_PRESENT) detections[zone_idx]++;
+
+			const float error = fabsf(zfx->magnitude - zfl->magnitude);
+			if (error > MAGNITUDE_TOLERANCE_REL * zfl->magnitude + MAGNITUDE_TOLERANCE_ABS)
+			{
+				printf("Frame %u zone %u: magnitude float %.4f fixed %.4f\n", frame_idx, zone_idx, zfl->magnitude, zfx->magnitude);
+				errors++;
+			}
+			if ((zfl->magnitude > zones[zone_idx].threshold_exit) && (error / zfl->magnitude > max_error))
+			{
+				max_error = error / zfl->magnitude;
+			}
+
+			const bool peak_valid = (zfl->state == PRESENCE_STATE_PRESENT) && (zfx->state == PRESENCE_STATE_PRESENT) && (zfl->magnitude > zones[zone_idx].threshold);
+			if (peak_valid && (fabsf(zfx->peak.distance - zfl->peak.distance) > DISTANCE_TOLERANCE))
+			{
+				printf("Frame %u zone %u: distance float %.3f fixed %.3f\n", frame_idx, zone_idx, zfl->peak.distance, zfx->peak.distance);
+				errors++;
+			}
+		}
+
+		if ((fl->magnitude > zones[0].threshold) && (fl->bin != fx->bin))
+		{
+			printf("Frame %u: maximum bin float %u fixed %u\n", frame_idx, fl->bin, fx->bin);
+			errors++;
+		}
+	}
+
+	for(uint8_t zone_idx = 0; zone_idx < zone_count; ++zone_idx)
+	{
+		transition_t float_transitions[MAX_TRANSITIONS];
+		transition_t fixed_transitions[MAX_TRANSITIONS];
+		const uint32_t float_count = get_transitions(float_results, zone_idx, float_transitions);
+		const uint32_t fixed_count = get_transitions(fixed_results, zone_idx, fixed_transitions);
+		if (float_count != fixed_count)
+		{
+			printf("Zone %u: %u state changes (float) %u (fixed)\n", zone_idx, float_count, fixed_count);
+			errors++;
+			continue;
+		}
+
+		for(uint32_t i = 0; i < float_count; ++i)
+		{
+			const transition_t* fl = &float_transitions[i];
+			const transition_t* fx = &fixed_transitions[i];
+			const uint32_t delay = (fl->frame > fx->frame) ? (fl->frame - fx->frame) : (fx->frame - fl->frame);
+			if ((fl->state != fx->state) || (delay > TRANSITION_TOLERANCE))
+			{
+				printf("Zone %u: state %d at frame %u (float), state %d at frame %u (fixed)\n", zone_idx, fl->state, fl->frame, fx->state, fx->frame);
+				errors++;
+			}
+		}
+	}
+
+	// The scene must trigger both zones, else the comparison proves nothing
+	for(uint8_t zone_idx = 0; zone_idx < zone_count; ++zone_idx)
+	{
+		printf("Zone %u: %u frames present\n", zone_idx, detections[zone_idx]);
+		if (detections[zone_idx] == 0)
+		{
+			printf("Zone %u: no detection in the scene\n", zone_idx);
+			errors++;
+		}
+	}
+	printf("Largest relative magnitude error above the exit threshold: %.2f %%\n", max_error * 100.f);
+
+	free(frames);
+	free(float_results);
+	free(fixed_results);
+
+	if (errors != 0)
+	{
+		printf("FAILED: %u errors\n", errors);
+		return 1;
+	}
+	printf("PASSED\n");
+	return 0;
+}
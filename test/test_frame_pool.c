@@ -0,0 +1,155 @@
+/*
+ * test_frame_pool.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Frame rate kept by bgt60trxxx.c on the simulated sensor (one frame per FIFO read) with a consumer needing
+ * PROCESSING_US per frame, at decreasing frame repetition times. Built with a single buffer (serial: the next
+ * frame is read once the previous one is released, read + processing per frame) and with the default pool
+ * (the read of the next frame runs during the processing: max(read, processing) per frame)
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "test_check.h"
+#include "sensor_sim.h"
+#include "bgt60trxxx.h"
+
+#include "cyhal_system.h"
+
+#include <stdio.h>
+
+/**
+ * Same default as bgt60trxxx.c (the serial build sets it to 1)
+ */
+#ifndef BGT60TRXXX_FRAME_POOL_SIZE
+#define BGT60TRXXX_FRAME_POOL_SIZE	2
+#endif
+
+/**
+ * SPI clock set by bgt60trxxx_init (BGT60TRXXX_SPI_FREQUENCY)
+ */
+#define SPI_FREQUENCY				12500000UL
+
+/**
+ * Processing time of a frame by the consumer
+ */
+#define PROCESSING_US				2000U
+
+/**
+ * Frames measured per frame repetition time
+ */
+#define FRAMES_PER_STEP				200U
+
+#define POLL_US						10
+
+/**
+ * Frame repetition times of the steps in seconds
+ */
+static const float frame_times[] = { 0.01f, 0.006f, 0.0045f, 0.003f, 0.0025f };
+
+typedef struct
+{
+	uint32_t frames;
+	uint32_t fifo_errors;
+	uint32_t data_errors;
+} consumer_t;
+
+static void check_frame(consumer_t* consumer, const uint16_t* samples)
+{
+	const uint32_t chirp_samples = (uint32_t) bgt60trxxx_get_antenna_count() * bgt60trxxx_get_samples_per_chirp();
+	for (uint16_t chirp = 0; chirp < bgt60trxxx_get_chirps_per_frame(); ++chirp)
+	{
+		if (samples[chirp * chirp_samples] != SENSOR_SIM_SAMPLE(chirp, 0))
+		{
+			consumer->data_errors++;
+			return;
+		}
+	}
+	consumer->frames++;
+}
+
+static void run(consumer_t* consumer, uint64_t duration_ns)
+{
+	const uint64_t end_ns = sensor_sim_get_time_ns() + duration_ns;
+	while (sensor_sim_get_time_ns() < end_ns)
+	{
+		uint16_t* frame;
+		const int retval = bgt60trxxx_acquire_frame(&frame);
+		if (retval == 0)
+		{
+			check_frame(consumer, frame);
+			CyDelayUs(PROCESSING_US);
+			bgt60trxxx_release_frame(frame);
+		}
+		else if (retval < 0)
+		{
+			consumer->fifo_errors++;
+		}
+		else
+		{
+			CyDelayUs(POLL_US);
+		}
+	}
+}
+
+int main()
+{
+	sensor_sim_reset();
+	if (bgt60trxxx_init() != 0)
+	{
+		printf("bgt60trxxx_init failed\n");
+		return 1;
+	}
+
+	// Bus time of a frame read: burst command then the packed samples
+	const uint32_t frame_bytes = (bgt60trxxx_get_samples_per_frame() * 12U) / 8U;
+	const double read_us = (2.0 * SENSOR_SIM_TRANSFER_OVERHEAD_NS + (4.0 + frame_bytes) * 8e9 / SPI_FREQUENCY) / 1000.0;
+	const double serial_us = read_us + PROCESSING_US;
+	const double pool_us = (read_us > PROCESSING_US) ? read_us : PROCESSING_US;
+	const double frame_limit_us = (BGT60TRXXX_FRAME_POOL_SIZE > 1) ? pool_us : serial_us;
+	printf("Pool of %u buffers, read %.0f us, processing %u us: every frame kept down to %.0f us\n",
+			BGT60TRXXX_FRAME_POOL_SIZE, read_us, PROCESSING_US, frame_limit_us);
+
+	for (uint8_t step = 0; step < sizeof(frame_times) / sizeof(frame_times[0]); ++step)
+	{
+		const float frame_time = frame_times[step];
+		if (bgt60trxxx_set_frame_repetition_time(frame_time) != 0)
+		{
+			printf("%.1f ms: bgt60trxxx_set_frame_repetition_time failed\n", frame_time * 1000.f);
+			errors++;
+			continue;
+		}
+
+		consumer_t consumer = { 0 };
+		sensor_sim_stats_t before, after;
+		sensor_sim_get_stats(&before);
+		run(&consumer, (uint64_t)(FRAMES_PER_STEP * frame_time * 1e9));
+		sensor_sim_get_stats(&after);
+
+		const uint32_t frames = after.frames - before.frames;
+		printf("%4.1f ms: %3u frames measured, %3u processed (%3.0f %%), %u FIFO errors\n",
+				frame_time * 1000.f, frames, consumer.frames, 100.0 * consumer.frames / frames, consumer.fifo_errors);
+
+		if (consumer.data_errors != 0)
+		{
+			printf("%.1f ms: %u frames with wrong data\n", frame_time * 1000.f, consumer.data_errors);
+			errors++;
+		}
+
+		// Above the limit of the buffering every frame is processed (the last ones can still be in the pipeline)
+		if ((frame_time * 1e6 > frame_limit_us * 1.1) && ((consumer.frames + BGT60TRXXX_FRAME_POOL_SIZE + 1U < frames) || (consumer.fifo_errors != 0)))
+		{
+			printf("%.1f ms: frames lost above %.0f us\n", frame_time * 1000.f, frame_limit_us);
+			errors++;
+		}
+	}
+
+	return check_result();
+}
@@ -0,0 +1,117 @@
+/*
+ * test_presence_config.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Configuration of the presence detection: vital signs suspended when the initial frame rate is too low for the
+ * respiration band (as for a reconfiguration) and resumed with a faster configuration, allocation failure of
+ * the Doppler output reported by presence_detection_init and by presence_detection_set_radar_configuration (the
+ * data are rejected until a valid configuration is set again)
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "test_check.h"
+#include "radar_frames.h"
+#include "presence_detection.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Frame repetition time of the low frame rate profile (RADAR_PROFILE_LOW_FREQ)
+ */
+#define LOW_FRAME_RATE_TIME_S	1.00167f
+
+/**
+ * The allocations of fail_size bytes fail
+ */
+static size_t fail_size = 0;
+
+static void* test_malloc(size_t size)
+{
+	if ((fail_size != 0) && (size == fail_size)) return NULL;
+	return malloc(size);
+}
+
+static presence_detection_param_t get_params()
+{
+	presence_detection_param_t params;
+	memset(&params, 0, sizeof(params));
+	params.threshold = 0.56f;
+	params.threshold_exit = 0.42f;
+	params.confirm_frames = 3;
+	params.hold_frames = 10;
+	params.bin_start = 0;
+	params.bin_end = 0;
+	params.slow_time_history = 1;
+	params.vital_signs = true;
+	params.arithmetic = PRESENCE_DETECTION_ARITHMETIC_FLOAT;
+	params.range_cube_format = RANGE_CUBE_FORMAT_FLOAT32;
+	params.range_zoom = 1;
+	params.range_fft_padding = 1;
+	params.range_window = WINDOW_BLACKMAN_HARRIS;
+	params.doppler_window = WINDOW_NONE;
+	return params;
+}
+
+int main()
+{
+	const radar_configuration_t config = radar_frames_get_default_configuration();
+	radar_configuration_t low_rate_config = config;
+	low_rate_config.frame_repetition_time = LOW_FRAME_RATE_TIME_S;
+
+	presence_detection_set_malloc_free(test_malloc, free);
+
+	// Start at the low frame rate: vital signs suspended, resumed at the frame rate of the default profile
+	const int retval = presence_detection_init(low_rate_config, get_params());
+	printf("init at %.2f s per frame: %d\n", LOW_FRAME_RATE_TIME_S, retval);
+	check("init at the low frame rate", retval == 0);
+	check("vital signs suspended", presence_detection_get_vital_signs() == NULL);
+	check("faster configuration", presence_detection_set_radar_configuration(config) == 0);
+	check("vital signs resumed", presence_detection_get_vital_signs() != NULL);
+	check("low frame rate again", presence_detection_set_radar_configuration(low_rate_config) == 0);
+	check("vital signs suspended again", presence_detection_get_vital_signs() == NULL);
+
+	// Allocation failure of the Doppler output (larger configuration: the buffers are reallocated)
+	radar_configuration_t larger_config = config;
+	larger_config.chirps_per_frame = config.chirps_per_frame * 2U;
+	fail_size = larger_config.chirps_per_frame * sizeof(cfloat32_t);
+	const int failure = presence_detection_init(larger_config, get_params());
+	printf("Doppler output allocation failure: %d\n", failure);
+	check("Doppler output allocation failure", failure == -7);
+
+	fail_size = 0;
+	check("init after the failure", presence_detection_init(larger_config, get_params()) == 0);
+
+	// Failed reconfiguration (profile switch): the detector keeps nothing half configured
+	check("init", presence_detection_init(config, get_params()) == 0);
+	radar_configuration_t switch_config = config;
+	switch_config.chirps_per_frame = config.chirps_per_frame * 4U;
+	fail_size = switch_config.chirps_per_frame * sizeof(cfloat32_t);
+	const int switch_failure = presence_detection_set_radar_configuration(switch_config);
+	fail_size = 0;
+	printf("reconfiguration with allocation failure: %d\n", switch_failure);
+	check("reconfiguration failure", switch_failure == -7);
+
+	const uint32_t frame_size = radar_frames_get_frame_size(&switch_config);
+	uint16_t* frame = calloc(frame_size, sizeof(uint16_t));
+	presence_detection_frame_result_t result;
+	check("chirps rejected", presence_detection_feed_chirps(frame, 0, switch_config.chirps_per_frame) == -21);
+	check("frame rejected", presence_detection_feed(frame) == -21);
+	check("batch rejected", presence_detection_feed_batch(frame, 1, &result) == -21);
+
+	// Back to the previous configuration
+	check("previous configuration", presence_detection_set_radar_configuration(config) == 0);
+	check("chirps accepted", presence_detection_feed_chirps(frame, 0, config.chirps_per_frame) == 1);
+	free(frame);
+
+	return check_result();
+}
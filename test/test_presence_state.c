@@ -0,0 +1,327 @@
+/*
+ * test_presence_state.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * State machine of the presence detection (presence_state.c) fed with scripted magnitudes: exact frame of each
+ * transition (candidate, present, holding, absent) for several confirm_frames / hold_frames, a candidate dropping
+ * back to absent, the hold boundary. The listener of the presence detection must be called once per state change
+ * (same frames as the changed flags of the batch processing) and never by the batch processing.
+ * Slow-time buffer (slow_time_buffer.c): samples and history across the wrap of the ring buffer, copies split in
+ * two segments
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "test_check.h"
+#include "radar_frames.h"
+#include "presence_detection.h"
+#include "presence_state.h"
+#include "slow_time_buffer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define THRESHOLD_ENTER			1.f
+#define THRESHOLD_EXIT			0.5f
+
+#define MAX_MAGNITUDES			16
+
+/**
+ * Magnitudes fed to the state machine and expected state after each frame
+ * (A -> ABSENT, C -> CANDIDATE, P -> PRESENT, H -> HOLDING)
+ */
+typedef struct
+{
+	const char* name;
+	uint16_t confirm_frames;
+	uint16_t hold_frames;
+	float magnitudes[MAX_MAGNITUDES];
+	const char* expected;
+} state_scenario_t;
+
+static const state_scenario_t state_scenarios[] =
+{
+	// Candidate dropping back (above the exit threshold is not enough), confirmed at the third frame,
+	// present again while holding, absent at the third frame below the exit threshold
+	{ "confirm 3, hold 2", 3, 2, { 2.f, 2.f, 0.8f, 2.f, 2.f, 2.f, 0.8f, 0.4f, 0.4f, 0.6f, 0.4f, 0.4f, 0.4f }, "CCACCPPHHPHHA" },
+	// Confirmed at the first frame above the enter threshold (equal is not above), absent without holding
+	{ "confirm 1, hold 0", 1, 0, { 0.8f, 1.f, 2.f, 0.6f, 0.4f, 2.f }, "AAPPAP" },
+	// Same as confirm 1, absent at the second frame below the exit threshold (equal is not above)
+	{ "confirm 0, hold 1", 0, 1, { 0.8f, 2.f, 0.4f, 0.5f, 0.4f, 2.f }, "APHAAP" },
+};
+
+static const char state_names[] = { 'A', 'C', 'P', 'H' };
+
+#define FRAME_COUNT				200
+#define MAX_EVENTS				32
+
+static const presence_detection_zone_t zones[] =
+{
+	{ .start = 0.3f, .end = 2.f, .threshold = 0.56f, .threshold_exit = 0.42f },
+	{ .start = 2.f, .end = 5.f, .threshold = 0.56f, .threshold_exit = 0.42f },
+};
+
+/**
+ * Same scene as test_fixed_point.c: a person walking away through both zones, then a second person walking back
+ * inside the far zone
+ */
+static const radar_frames_scene_t scene =
+{
+	.targets =
+	{
+		{ .distance = 0.8f, .velocity = 0.25f, .amplitude = 30.f, .breathing_amplitude = 0.004f, .breathing_rate = 0.3f, .first_frame = 40, .last_frame = 119 },
+		{ .distance = 4.5f, .velocity = -0.4f, .amplitude = 20.f, .breathing_amplitude = 0, .breathing_rate = 0, .first_frame = 140, .last_frame = 179 },
+	},
+	.target_count = 2,
+	.noise = 2.f,
+	.seed = 12345,
+};
+
+typedef struct
+{
+	uint32_t frame;
+	presence_detection_event_t event;
+} recorded_event_t;
+
+static recorded_event_t events[MAX_EVENTS];
+static uint32_t event_count = 0;
+static uint32_t current_frame = 0;
+
+static void listener(const presence_detection_event_t* event)
+{
+	if (event_count < MAX_EVENTS)
+	{
+		events[event_count].frame = current_frame;
+		events[event_count].event = *event;
+	}
+	event_count++;
+}
+
+static void run_state_scenario(const state_scenario_t* scenario)
+{
+	presence_state_param_t params;
+	params.threshold_enter = THRESHOLD_ENTER;
+	params.threshold_exit = THRESHOLD_EXIT;
+	params.confirm_frames = scenario->confirm_frames;
+	params.hold_frames = scenario->hold_frames;
+
+	presence_state_machine_t sm;
+	presence_state_init(&sm, params);
+	check(scenario->name, sm.state == PRESENCE_STATE_ABSENT);
+
+	char states[MAX_MAGNITUDES + 1] = { 0 };
+	const size_t frame_count = strlen(scenario->expected);
+	uint32_t change_errors = 0;
+	for (size_t frame = 0; frame < frame_count; ++frame)
+	{
+		const presence_state_t previous = sm.state;
+		const bool changed = presence_state_update(&sm, scenario->magnitudes[frame]);
+		if (changed != (sm.state != previous)) change_errors++;
+		states[frame] = state_names[sm.state];
+	}
+
+	printf("%s: %s (expected %s)\n", scenario->name, states, scenario->expected);
+	check(scenario->name, strcmp(states, scenario->expected) == 0);
+	check("state changes reported", change_errors == 0);
+}
+
+static presence_detection_param_t get_params()
+{
+	presence_detection_param_t params = { 0 };
+	params.threshold = 0.56f;
+	params.threshold_exit = 0.42f;
+	params.confirm_frames = 3;
+	params.hold_frames = 10;
+	params.zones = zones;
+	params.zone_count = sizeof(zones) / sizeof(zones[0]);
+	params.slow_time_history = 1;
+	params.vital_signs = true;
+	params.arithmetic = PRESENCE_DETECTION_ARITHMETIC_FLOAT;
+	params.range_cube_format = RANGE_CUBE_FORMAT_FLOAT32;
+	params.range_zoom = 1;
+	params.range_fft_padding = 1;
+	params.range_window = WINDOW_BLACKMAN_HARRIS;
+	params.doppler_window = WINDOW_NONE;
+	return params;
+}
+
+/**
+ * @brief Events of the frame by frame processing against the state changes of the batch processing (same frames)
+ */
+static void run_listener()
+{
+	const radar_configuration_t config = radar_frames_get_default_configuration();
+	const uint32_t frame_size = radar_frames_get_frame_size(&config);
+	uint16_t* frames = malloc(FRAME_COUNT * frame_size * sizeof(uint16_t));
+	presence_detection_frame_result_t* results = calloc(FRAME_COUNT, sizeof(presence_detection_frame_result_t));
+	if ((frames == NULL) || (results == NULL))
+	{
+		check("listener: allocation", false);
+		free(frames);
+		free(results);
+		return;
+	}
+	radar_frames_generate(&config, &scene, frames, FRAME_COUNT);
+
+	presence_detection_set_malloc_free(malloc, free);
+	presence_detection_set_listener(listener);
+
+	check("listener: init", presence_detection_init(config, get_params()) == 0);
+	for (current_frame = 0; current_frame < FRAME_COUNT; ++current_frame)
+	{
+		presence_detection_feed(&frames[current_frame * frame_size]);
+	}
+	const uint32_t feed_events = event_count;
+
+	check("batch: init", presence_detection_init(config, get_params()) == 0);
+	check("batch", presence_detection_feed_batch(frames, FRAME_COUNT, results) == 0);
+	check("listener not called by the batch processing", event_count == feed_events);
+
+	// One event per changed flag, in the same order
+	uint32_t expected_count = 0;
+	uint32_t mismatches = 0;
+	presence_state_t previous_states[sizeof(zones) / sizeof(zones[0])] = { PRESENCE_STATE_ABSENT, PRESENCE_STATE_ABSENT };
+	for (uint32_t frame = 0; frame < FRAME_COUNT; ++frame)
+	{
+		for (uint8_t zone_idx = 0; zone_idx < sizeof(zones) / sizeof(zones[0]); ++zone_idx)
+		{
+			const presence_detection_zone_frame_result_t* zone = &results[frame].zones[zone_idx];
+			if (zone->changed != (zone->state != previous_states[zone_idx])) mismatches++;
+			if (zone->changed)
+			{
+				const recorded_event_t* recorded = (expected_count < MAX_EVENTS) ? &events[expected_count] : NULL;
+				if ((recorded == NULL) || (recorded->frame != frame) || (recorded->event.zone != zone_idx)
+						|| (recorded->event.state != zone->state) || (recorded->event.previous_state != previous_states[zone_idx]))
+				{
+					printf("frame %u zone %u: state %c -> %c without matching event\n", frame, zone_idx,
+							state_names[previous_states[zone_idx]], state_names[zone->state]);
+					mismatches++;
+				}
+				expected_count++;
+			}
+			previous_states[zone_idx] = zone->state;
+		}
+	}
+
+	printf("listener: %u events, %u state changes\n", feed_events, expected_count);
+	for (uint32_t i = 0; (i < feed_events) && (i < MAX_EVENTS); ++i)
+	{
+		printf("  frame %3u zone %u: %c -> %c\n", events[i].frame, events[i].event.zone,
+				state_names[events[i].event.previous_state], state_names[events[i].event.state]);
+	}
+	check("listener called once per state change", (feed_events == expected_count) && (mismatches == 0));
+	// The scene must trigger both zones, else the comparison proves nothing
+	check("state changes in the scene", expected_count >= 4U);
+
+	presence_detection_set_listener(NULL);
+	free(frames);
+	free(results);
+}
+
+static cfloat32_t get_sample(uint16_t bin, uint32_t frame)
+{
+	cfloat32_t sample;
+	sample.data[0] = (float)(bin * 1000U + frame);
+	sample.data[1] = -(float) frame;
+	return sample;
+}
+
+static bool is_sample(cfloat32_t sample, uint16_t bin, uint32_t frame)
+{
+	const cfloat32_t expected = get_sample(bin, frame);
+	return (sample.data[0] == expected.data[0]) && (sample.data[1] == expected.data[1]);
+}
+
+/**
+ * @brief Slow-time buffer of 2 bins, 4 frames, filled with 11 frames (two wraps)
+ */
+static void run_slow_time_buffer()
+{
+	const uint16_t bin_count = 2;
+	const uint16_t history_len = 4;
+	cfloat32_t storage[2 * 4];
+	slow_time_buffer_t buffer;
+
+	check("slow-time buffer: storage size", slow_time_buffer_get_storage_size(bin_count, history_len) == sizeof(storage));
+	check("slow-time buffer: no storage", slow_time_buffer_init(&buffer, NULL, bin_count, history_len) == -2);
+	check("slow-time buffer: no history", slow_time_buffer_init(&buffer, storage, bin_count, 0) == -3);
+	check("slow-time buffer: init", slow_time_buffer_init(&buffer, storage, bin_count, history_len) == 0);
+
+	uint32_t sample_errors = 0;
+	uint32_t copy_errors = 0;
+	uint32_t split_copies = 0;
+	for (uint32_t frame = 0; frame < 11U; ++frame)
+	{
+		for (uint16_t bin = 0; bin < bin_count; ++bin)
+		{
+			slow_time_buffer_set(&buffer, bin, get_sample(bin, frame));
+		}
+		slow_time_buffer_advance(&buffer);
+
+		const uint16_t count = (frame + 1U < history_len) ? (uint16_t)(frame + 1U) : history_len;
+		if (buffer.count != count) sample_errors++;
+
+		for (uint16_t bin = 0; bin < bin_count; ++bin)
+		{
+			// Samples of the history, 0 beyond
+			for (uint16_t age = 0; age <= history_len; ++age)
+			{
+				const cfloat32_t sample = slow_time_buffer_get(&buffer, bin, age);
+				if (age < count)
+				{
+					if (!is_sample(sample, bin, frame - age)) sample_errors++;
+				}
+				else if ((sample.data[0] != 0) || (sample.data[1] != 0))
+				{
+					sample_errors++;
+				}
+			}
+
+			// Newest len frames, oldest first (split in two segments when they wrap around the end of the storage)
+			for (uint16_t len = 1; len <= history_len + 1U; ++len)
+			{
+				cfloat32_t out[4 + 1];
+				const uint16_t copied = slow_time_buffer_copy_history(&buffer, bin, out, len);
+				const uint16_t expected_copied = (len < count) ? len : count;
+				if (copied != expected_copied)
+				{
+					copy_errors++;
+					continue;
+				}
+				if ((buffer.write_idx != 0) && (copied > buffer.write_idx)) split_copies++;
+				for (uint16_t i = 0; i < copied; ++i)
+				{
+					if (!is_sample(out[i], bin, frame + 1U - copied + i)) copy_errors++;
+				}
+			}
+		}
+	}
+	printf("slow-time buffer: %u sample errors, %u copy errors, %u split copies\n", sample_errors, copy_errors, split_copies);
+	check("slow-time buffer: samples", sample_errors == 0);
+	check("slow-time buffer: copies", copy_errors == 0);
+	check("slow-time buffer: split copies done", split_copies != 0);
+
+	cfloat32_t out[4];
+	slow_time_buffer_reset(&buffer);
+	check("slow-time buffer: reset", (buffer.count == 0) && (slow_time_buffer_copy_history(&buffer, 0, out, history_len) == 0));
+}
+
+int main()
+{
+	for (uint8_t i = 0; i < sizeof(state_scenarios) / sizeof(state_scenarios[0]); ++i)
+	{
+		run_state_scenario(&state_scenarios[i]);
+	}
+
+	run_listener();
+	run_slow_time_buffer();
+
+	return check_result();
+}
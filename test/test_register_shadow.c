@@ -0,0 +1,133 @@
+/*
+ * test_register_shadow.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Register shadow of the sensor driver against the register file of the simulated sensor:
+ * every valid shadow entry holds the register content, the read-modify-writes cost a single transfer,
+ * the resets invalidate what they change
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "test_check.h"
+#include "sensor_sim.h"
+#include "radar_profiles.h"
+
+#include "xensiv_bgt60trxx.h"
+
+#include <stdio.h>
+
+static xensiv_bgt60trxx_t dev;
+static bool is_valid(uint32_t address)
+{
+	return (dev.shadow_valid[address / 32U] & (1UL << (address % 32U))) != 0;
+}
+
+static uint32_t count_valid()
+{
+	uint32_t count = 0;
+	for (uint32_t address = 0; address < XENSIV_BGT60TRXX_SHADOW_NUM_REGS; ++address)
+	{
+		if (is_valid(address)) count++;
+	}
+	return count;
+}
+
+/**
+ * @brief Every valid entry of the shadow must hold the register content
+ */
+static void check_shadow(const char* step)
+{
+	for (uint32_t address = 0; address < XENSIV_BGT60TRXX_SHADOW_NUM_REGS; ++address)
+	{
+		if (is_valid(address) && (dev.shadow[address] != sensor_sim_get_register(address)))
+		{
+			printf("%s: shadow of register 0x%02X is 0x%06X, register 0x%06X\n", step, address, dev.shadow[address], sensor_sim_get_register(address));
+			errors++;
+		}
+	}
+	printf("%s: %u valid registers\n", step, count_valid());
+}
+
+/**
+ * @brief SPI transfers of the last step
+ */
+static void check_transfers(const char* step, uint32_t expected_transfers, uint32_t expected_reads)
+{
+	sensor_sim_stats_t stats;
+	sensor_sim_get_stats(&stats);
+	if ((stats.transfers != expected_transfers) || (stats.register_reads != expected_reads))
+	{
+		printf("%s: %u transfers (%u reads) instead of %u (%u reads)\n", step, stats.transfers, stats.register_reads, expected_transfers, expected_reads);
+		errors++;
+	}
+	sensor_sim_clear_stats();
+}
+
+int main()
+{
+	const radar_profile_t* profile = &radar_profiles[RADAR_PROFILE_DEFAULT];
+	uint32_t value;
+
+	sensor_sim_reset();
+	check("init", xensiv_bgt60trxx_init(&dev, sensor_sim_get_iface(), false) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_shadow("init");
+
+	check("config", xensiv_bgt60trxx_config(&dev, profile->registers, profile->register_count) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_shadow("config");
+	check("config: every register of the profile cached", count_valid() >= profile->register_count);
+	sensor_sim_clear_stats();
+
+	// Read-modify-writes from the shadow: a single write each
+	check("set_fifo_limit", xensiv_bgt60trxx_set_fifo_limit(&dev, 2048) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_transfers("set_fifo_limit", 1, 0);
+	check("enable_data_test_mode", xensiv_bgt60trxx_enable_data_test_mode(&dev, true) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_transfers("enable_data_test_mode", 1, 0);
+	check("disable_data_test_mode", xensiv_bgt60trxx_enable_data_test_mode(&dev, false) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_transfers("disable_data_test_mode", 1, 0);
+	check_shadow("read-modify-writes");
+
+	// The self-clearing frame start bit is not stored: starting twice writes the same value
+	check("start_frame", xensiv_bgt60trxx_start_frame(&dev, true) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_transfers("start_frame", 1, 0);
+	check("start_frame: frame start bit not cached", (dev.shadow[XENSIV_BGT60TRXX_REG_MAIN] & XENSIV_BGT60TRXX_REG_MAIN_FRAME_START_MSK) == 0);
+	check_shadow("start_frame");
+
+	// FSM reset (stop): the configuration is kept, MAIN is polled until the reset bit clears
+	check("stop_frame", xensiv_bgt60trxx_start_frame(&dev, false) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_transfers("stop_frame", 2, 1);
+	check("stop_frame: configuration still cached", is_valid(XENSIV_BGT60TRXX_REG_SFCTL));
+	check_shadow("stop_frame");
+
+	// Cached register: no SPI read
+	check("get_reg_cached", xensiv_bgt60trxx_get_reg_cached(&dev, XENSIV_BGT60TRXX_REG_SFCTL, &value) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_transfers("get_reg_cached", 0, 0);
+	check("get_reg_cached: value", value == sensor_sim_get_register(XENSIV_BGT60TRXX_REG_SFCTL));
+
+	// Status register (never written): always read from the sensor
+	check("get_reg_cached status", xensiv_bgt60trxx_get_reg_cached(&dev, XENSIV_BGT60TRXX_REG_STAT1, &value) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_transfers("get_reg_cached status", 1, 1);
+
+	// SW reset: all the registers are back to their reset value
+	check("soft_reset", xensiv_bgt60trxx_soft_reset(&dev, XENSIV_BGT60TRXX_RESET_SW) == XENSIV_BGT60TRXX_STATUS_OK);
+	check("soft_reset: shadow invalidated", count_valid() == 0);
+	sensor_sim_clear_stats();
+	check("get_reg_cached after reset", xensiv_bgt60trxx_get_reg_cached(&dev, XENSIV_BGT60TRXX_REG_SFCTL, &value) == XENSIV_BGT60TRXX_STATUS_OK);
+	check_transfers("get_reg_cached after reset", 1, 1);
+	check("get_reg_cached after reset: value", value == sensor_sim_get_register(XENSIV_BGT60TRXX_REG_SFCTL));
+
+	// Hard reset
+	check("config again", xensiv_bgt60trxx_config(&dev, profile->registers, profile->register_count) == XENSIV_BGT60TRXX_STATUS_OK);
+	xensiv_bgt60trxx_hard_reset(&dev);
+	check("hard_reset: shadow invalidated", count_valid() == 0);
+	check_shadow("hard_reset");
+
+	return check_result();
+}
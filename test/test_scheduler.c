@@ -0,0 +1,384 @@
+/*
+ * test_scheduler.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * Event scheduler (scheduler.c) on a simulated platform: periodic interrupt posting an event, masking of the
+ * interrupts (an interrupt raised while masked is pending until the unmasking), WFI wakes up at the next
+ * interrupt or at the alarm, tasks consume simulated time. Checks the dispatching of the events, the delayed
+ * events (the sleep ends at their deadline) and the idle accounting, with a time counter wrapping around
+ * during the measurement
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "test_check.h"
+#include "scheduler.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#define EVENT_IRQ			(1UL << 0)
+#define EVENT_OTHER			(1UL << 1)
+
+/**
+ * Start of the time counter: wraps around after 65.5 ms
+ */
+#define TIME_START_US		0xFFFF0000UL
+
+/**
+ * Simulated platform
+ */
+static uint64_t sim_time = 0;			/**< Elapsed time in us (does not wrap) */
+static uint32_t irq_period = 0;			/**< 0 -> no interrupt */
+static uint64_t next_irq = 0;
+static bool masked = false;
+static bool irq_pending = false;
+static uint32_t irq_raised = 0;
+static uint32_t irq_handled = 0;
+static uint32_t sleeps_masked_error = 0;
+static bool alarm_armed = false;
+static uint64_t alarm_time = 0;
+static uint32_t alarms = 0;
+
+/**
+ * Time consumed by the tasks
+ */
+static uint64_t busy_time = 0;
+
+static void irq_handler(void)
+{
+	irq_handled++;
+	scheduler_post(EVENT_IRQ);
+}
+
+/**
+ * @brief Raise the interrupts due, run the pending one if not masked
+ */
+static void update_irq()
+{
+	if (alarm_armed && (sim_time >= alarm_time))
+	{
+		// The alarm handler only wakes the CPU up
+		alarm_armed = false;
+		alarms++;
+	}
+
+	while ((irq_period != 0) && (sim_time >= next_irq))
+	{
+		irq_pending = true;
+		irq_raised++;
+		next_irq += irq_period;
+	}
+
+	if (irq_pending && !masked)
+	{
+		irq_pending = false;
+		irq_handler();
+	}
+}
+
+static uint32_t sim_get_time(void)
+{
+	return (uint32_t)(TIME_START_US + sim_time);
+}
+
+static uint32_t sim_critical_enter(void)
+{
+	const uint32_t state = masked;
+	masked = true;
+	return state;
+}
+
+static void sim_critical_exit(uint32_t state)
+{
+	masked = (state != 0);
+	update_irq();
+}
+
+static void sim_sleep(void)
+{
+	if (!masked) sleeps_masked_error++;
+
+	// WFI: returns at once if an interrupt is pending, else at the next one (interrupt or alarm)
+	if (irq_pending) return;
+	if ((irq_period != 0) && (!alarm_armed || (next_irq < alarm_time)))
+	{
+		sim_time = next_irq;
+	}
+	else if (alarm_armed)
+	{
+		sim_time = alarm_time;
+	}
+	update_irq();
+}
+
+static void sim_set_alarm(uint32_t delay)
+{
+	alarm_armed = true;
+	alarm_time = sim_time + delay;
+}
+
+static const scheduler_platform_t platform =
+{
+	.get_time = sim_get_time,
+	.critical_enter = sim_critical_enter,
+	.critical_exit = sim_critical_exit,
+	.sleep = sim_sleep,
+	.set_alarm = sim_set_alarm,
+};
+
+/**
+ * Same platform without alarm
+ */
+static const scheduler_platform_t platform_no_alarm =
+{
+	.get_time = sim_get_time,
+	.critical_enter = sim_critical_enter,
+	.critical_exit = sim_critical_exit,
+	.sleep = sim_sleep,
+};
+
+/**
+ * @brief Processing time of a task (the interrupts are served meanwhile)
+ */
+static void busy(uint32_t us)
+{
+	const uint64_t end = sim_time + us;
+	while (sim_time < end)
+	{
+		sim_time = ((irq_period != 0) && (next_irq < end)) ? next_irq : end;
+		update_irq();
+	}
+	busy_time += us;
+}
+
+static void sim_reset(uint32_t period)
+{
+	sim_time = 0;
+	irq_period = period;
+	next_irq = period;
+	masked = false;
+	irq_pending = false;
+	irq_raised = 0;
+	irq_handled = 0;
+	sleeps_masked_error = 0;
+	alarm_armed = false;
+	alarms = 0;
+	busy_time = 0;
+}
+
+/**
+ * Task of the periodic scenarios
+ */
+static uint32_t task_us = 0;
+static uint32_t task_runs = 0;
+
+static void periodic_task(uint32_t events)
+{
+	check("periodic task: events", events == EVENT_IRQ);
+	busy(task_us);
+	task_runs++;
+}
+
+/**
+ * @brief Interrupt every period_us, task_us of processing per event, during duration_us
+ */
+static void run_periodic(const char* name, uint32_t period_us, uint32_t processing_us, uint64_t duration_us, scheduler_stats_t* stats)
+{
+	sim_reset(period_us);
+	task_us = processing_us;
+	task_runs = 0;
+	check(name, scheduler_init(&platform) == 0);
+	check(name, scheduler_add_task(periodic_task, EVENT_IRQ) == 0);
+
+	while (sim_time < duration_us)
+	{
+		scheduler_run_once();
+	}
+	// Event of the last interrupt
+	scheduler_run_once();
+	scheduler_get_stats(stats);
+
+	printf("%s: %.2f %% idle, %llu us total, %llu us idle, %u wakeups, %u task runs, %u interrupts\n", name,
+			stats->idle_percent, (unsigned long long) stats->total_time, (unsigned long long) stats->idle_time,
+			stats->wakeups, stats->task_runs, irq_raised);
+
+	// Every microsecond is either idle or spent by the task
+	check("total time across the wrap around", stats->total_time == sim_time);
+	check("idle + busy = total", stats->idle_time + busy_time == stats->total_time);
+	check("task runs counted", stats->task_runs == task_runs);
+	check("every interrupt served", irq_handled == irq_raised);
+	check("sleeps with masked interrupts", sleeps_masked_error == 0);
+}
+
+/**
+ * Tasks of the dispatching scenario
+ */
+static uint32_t first_events = 0;
+static uint32_t second_events = 0;
+static uint32_t reposts = 0;
+
+static void first_task(uint32_t events)
+{
+	first_events |= events;
+}
+
+static void second_task(uint32_t events)
+{
+	second_events |= events;
+
+	// Event posted by a task: run again without sleeping
+	if (reposts > 0)
+	{
+		reposts--;
+		scheduler_post(EVENT_OTHER);
+	}
+}
+
+static void run_dispatching()
+{
+	sim_reset(0);
+
+	check("invalid platform", scheduler_init(NULL) == -1);
+	check("init", scheduler_init(&platform) == 0);
+	check("invalid task", scheduler_add_task(NULL, EVENT_IRQ) == -1);
+	check("task without events", scheduler_add_task(first_task, 0) == -1);
+	check("first task", scheduler_add_task(first_task, EVENT_IRQ) == 0);
+	check("second task", scheduler_add_task(second_task, EVENT_IRQ | EVENT_OTHER) == 0);
+	for (uint8_t i = 2; i < SCHEDULER_MAX_TASKS; ++i)
+	{
+		check("more tasks", scheduler_add_task(first_task, EVENT_IRQ) == 0);
+	}
+	check("too many tasks", scheduler_add_task(first_task, EVENT_IRQ) == -2);
+
+	// Only the tasks of the events posted run, with their own events
+	check("init", scheduler_init(&platform) == 0);
+	scheduler_add_task(first_task, EVENT_IRQ);
+	scheduler_add_task(second_task, EVENT_IRQ | EVENT_OTHER);
+
+	scheduler_post(EVENT_OTHER);
+	scheduler_run_once();
+	check("other event: first task not run", first_events == 0);
+	check("other event: second task", second_events == EVENT_OTHER);
+
+	first_events = 0;
+	second_events = 0;
+	scheduler_post(EVENT_IRQ | EVENT_OTHER);
+	scheduler_run_once();
+	check("both events: first task", first_events == EVENT_IRQ);
+	check("both events: second task", second_events == (EVENT_IRQ | EVENT_OTHER));
+
+	// Events posted by the task itself are run at the next call, the scheduler does not sleep meanwhile
+	scheduler_reset_stats();
+	reposts = 3;
+	scheduler_post(EVENT_OTHER);
+	for (uint8_t i = 0; i < 4; ++i)
+	{
+		scheduler_run_once();
+	}
+	scheduler_stats_t stats;
+	scheduler_get_stats(&stats);
+	check("reposted events", (reposts == 0) && (stats.task_runs == 4) && (stats.wakeups == 0));
+
+	// Nothing pending: sleep
+	scheduler_run_once();
+	scheduler_get_stats(&stats);
+	check("sleep without events", stats.wakeups == 1);
+}
+
+/**
+ * Task of the delayed events scenario: posts its event again after delayed_us (backoff), delayed_runs times
+ */
+static uint32_t delayed_us = 0;
+static uint32_t delayed_runs = 0;
+static uint64_t delayed_deadline = 0;
+static uint32_t delayed_late = 0;
+
+static void delayed_task(uint32_t events)
+{
+	if (events & EVENT_OTHER)
+	{
+		// Not before the deadline, at the deadline when nothing else runs
+		if (sim_time != delayed_deadline) delayed_late++;
+		delayed_runs++;
+	}
+	busy(task_us);
+
+	if ((events & EVENT_OTHER) && (delayed_runs < 10U))
+	{
+		delayed_deadline = sim_time + delayed_us;
+		scheduler_post_delayed(EVENT_OTHER, delayed_us);
+	}
+}
+
+/**
+ * @brief Event posted again 30 ms after each run (with the periodic interrupt of period_us meanwhile)
+ */
+static void run_delayed(const char* name, const scheduler_platform_t* hooks, uint32_t period_us, scheduler_stats_t* stats)
+{
+	sim_reset(period_us);
+	task_us = 1000U;
+	delayed_us = 30000U;
+	delayed_runs = 0;
+	delayed_late = 0;
+	check(name, scheduler_init(hooks) == 0);
+	check(name, scheduler_add_task(delayed_task, EVENT_IRQ | EVENT_OTHER) == 0);
+
+	delayed_deadline = sim_time;
+	scheduler_post(EVENT_OTHER);
+	for (uint32_t i = 0; (i < 100000U) && (delayed_runs < 10U); ++i)
+	{
+		scheduler_run_once();
+
+		// Without alarm the main loop polls: time of a pass
+		if (hooks->set_alarm == NULL) busy(10U);
+	}
+	scheduler_get_stats(stats);
+
+	printf("%s: %u delayed runs, %u late, %.2f %% idle, %u wakeups, %u alarms\n", name, delayed_runs, delayed_late,
+			stats->idle_percent, stats->wakeups, alarms);
+
+	check("delayed runs", delayed_runs == 10U);
+	check("idle + busy = total", stats->idle_time + busy_time == stats->total_time);
+	check("sleeps with masked interrupts", sleeps_masked_error == 0);
+}
+
+int main()
+{
+	scheduler_stats_t stats;
+
+	run_dispatching();
+
+	// Interrupt every 100 ms, 20 ms of processing: 80 % idle
+	run_periodic("100 ms period, 20 ms task", 100000U, 20000U, 10000000ULL, &stats);
+	check("80 % idle", (stats.idle_percent > 79.5f) && (stats.idle_percent < 80.5f));
+	check("one wakeup and one task run per interrupt", (stats.wakeups == irq_raised) && (stats.task_runs == irq_raised));
+
+	// Overload (15 ms of processing every 10 ms): idle only until the first interrupt, the events posted meanwhile are merged
+	run_periodic("10 ms period, 15 ms task", 10000U, 15000U, 1000000ULL, &stats);
+	check("no idle time", (stats.idle_time == 10000U) && (stats.wakeups == 1));
+	check("merged events", (stats.task_runs < irq_raised) && (stats.task_runs + 1U >= (uint32_t)(sim_time / 15000U)));
+
+	// Delayed event without other interrupt: the alarm ends the sleep at the deadline (no busy wait)
+	run_delayed("delayed event, alarm", &platform, 0, &stats);
+	check("delayed event on time", delayed_late == 0);
+	check("one sleep per delay", (stats.wakeups == 9U) && (alarms == 9U));
+	check("idle until the deadlines", (stats.idle_percent > 96.f) && (sim_time == 9U * 30000U + 10U * 1000U));
+
+	// Same with an interrupt every 7 ms: woken up by both, the delayed event still runs on time
+	run_delayed("delayed event, alarm and interrupts", &platform, 7000U, &stats);
+	check("delayed event with interrupts", delayed_late == 0);
+
+	// Without alarm: no sleep while the delayed event is pending (busy wait until the interrupt-free deadline)
+	run_delayed("delayed event, no alarm", &platform_no_alarm, 0, &stats);
+	check("no sleep without alarm", (stats.wakeups == 0) && (delayed_runs == 10U));
+
+	return check_result();
+}
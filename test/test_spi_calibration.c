@@ -0,0 +1,132 @@
+/*
+ * test_spi_calibration.c
+ *
+ *  Created on: 18 Oct 2026
+ *      Author: jorda
+ *
+ * SPI calibration of bgt60trxxx.c on the simulated sensor, whose FIFO data have bit errors above its MISO
+ * timing limit (a higher limit in high speed mode). The calibration must enable the high speed mode for the
+ * clocks above 25 MHz, select the fastest clock with margin, and the acquisition must work afterwards
+ * (also after a reconfiguration, which writes the encoded register configuration again)
+ *
+ * Rutronik Elektronische Bauelemente GmbH Disclaimer: The evaluation board
+ * including the software is for testing purposes only and,
+ * because it has limited functions and limited resilience, is not suitable
+ * for permanent use under real conditions. If the evaluation board is
+ * nevertheless used under real conditions, this is done at one’s responsibility;
+ * any liability of Rutronik is insofar excluded
+ */
+
+#include "test_check.h"
+#include "sensor_sim.h"
+#include "bgt60trxxx.h"
+
+#include "xensiv_bgt60trxx.h"
+#include "cyhal_system.h"
+
+#include <stdio.h>
+
+/**
+ * Frames checked after each calibration
+ */
+#define CHECKED_FRAMES				10U
+
+#define POLL_US						10
+
+typedef struct
+{
+	const char* name;
+	uint32_t max_frequency;			/**< MISO timing limit of the sensor */
+	uint32_t max_frequency_hs;		/**< Same in high speed mode */
+	uint32_t expected_frequency;	/**< Clock selected by the calibration */
+} scenario_t;
+
+static const scenario_t scenarios[] =
+{
+	// Every clock works in high speed mode
+	{ "fast sensor", 25000000UL, 50000000UL, 50000000UL },
+	// 50 MHz fails even in high speed mode: one step of margin below
+	{ "high speed up to 33 MHz", 25000000UL, 40000000UL, 25000000UL },
+	// 20 MHz fails: one step of margin below
+	{ "slow sensor", 17000000UL, 17000000UL, 12500000UL },
+};
+
+static bool is_high_speed()
+{
+	return (sensor_sim_get_register(XENSIV_BGT60TRXX_REG_SFCTL) & XENSIV_BGT60TRXX_REG_SFCTL_MISO_HS_READ_MSK) != 0;
+}
+
+/**
+ * @brief Acquire frames, returns the number of frames with wrong data or FIFO errors
+ */
+static uint32_t check_frames(uint32_t count)
+{
+	const uint32_t chirp_samples = (uint32_t) bgt60trxxx_get_antenna_count() * bgt60trxxx_get_samples_per_chirp();
+	uint32_t wrong = 0;
+	uint32_t frames = 0;
+	while (frames < count)
+	{
+		uint16_t* frame;
+		const int retval = bgt60trxxx_acquire_frame(&frame);
+		if (retval == 0)
+		{
+			for (uint32_t i = 0; i < bgt60trxxx_get_samples_per_frame(); ++i)
+			{
+				if (frame[i] != SENSOR_SIM_SAMPLE(i / chirp_samples, i % chirp_samples))
+				{
+					wrong++;
+					break;
+				}
+			}
+			bgt60trxxx_release_frame(frame);
+			frames++;
+		}
+		else if (retval < 0)
+		{
+			wrong++;
+			frames++;
+		}
+		else
+		{
+			CyDelayUs(POLL_US);
+		}
+	}
+	return wrong;
+}
+
+int main()
+{
+	sensor_sim_reset();
+	if (bgt60trxxx_init() != 0)
+	{
+		printf("bgt60trxxx_init failed\n");
+		return 1;
+	}
+	check("init: normal speed mode", !is_high_speed());
+
+	for (uint8_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); ++i)
+	{
+		const scenario_t* scenario = &scenarios[i];
+		sensor_sim_set_miso_limits(scenario->max_frequency, scenario->max_frequency_hs);
+
+		spi_calibration_result_t result;
+		const int retval = bgt60trxxx_calibrate_spi(&result);
+		printf("%s: %d, %.1f MHz selected, high speed mode %s\n", scenario->name, retval, result.frequency / 1e6, is_high_speed() ? "on" : "off");
+		for (uint8_t step = 0; step < result.step_count; ++step)
+		{
+			printf("  %4.1f MHz: status %d, %u words, %u bit errors\n", result.steps[step].frequency / 1e6,
+					result.steps[step].status, result.steps[step].words, result.steps[step].bit_errors);
+		}
+
+		check(scenario->name, (retval == 0) && (result.frequency == scenario->expected_frequency));
+		check("high speed mode above 25 MHz", is_high_speed() == (scenario->expected_frequency > 25000000UL));
+		check("frames after the calibration", check_frames(CHECKED_FRAMES) == 0);
+
+		// The reconfiguration writes the encoded configuration: the speed mode must be kept
+		check("reconfiguration", bgt60trxxx_reconfigure() == 0);
+		check("high speed mode after the reconfiguration", is_high_speed() == (scenario->expected_frequency > 25000000UL));
+		check("frames after the reconfiguration", check_frames(CHECKED_FRAMES) == 0);
+	}
+
+	return check_result();
+}